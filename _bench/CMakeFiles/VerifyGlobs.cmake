@@ -0,0 +1,23 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# RESULT_HEADERS at tests/CMakeLists.txt:187 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES false "/root/repo/include/*.hpp")
+set(OLD_GLOB
+  "/root/repo/include/result/backtrace.hpp"
+  "/root/repo/include/result/core.hpp"
+  "/root/repo/include/result/detail/optional.hpp"
+  "/root/repo/include/result/detail/usdt.hpp"
+  "/root/repo/include/result/expected.hpp"
+  "/root/repo/include/result/fd.hpp"
+  "/root/repo/include/result/niche.hpp"
+  "/root/repo/include/result/ptr_result.hpp"
+  "/root/repo/include/result/result.hpp"
+  "/root/repo/include/result/site_counters.hpp"
+  "/root/repo/include/result/timed.hpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_bench/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_compile_benchmarks.dir/compile_time_enum_sentinels.cpp.o"
+  "CMakeFiles/result_compile_benchmarks.dir/compile_time_enum_sentinels.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_compile_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
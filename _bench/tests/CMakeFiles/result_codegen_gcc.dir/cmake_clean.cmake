@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_codegen_gcc"
+  "result_codegen_gcc.o"
+  "result_codegen_gcc.stamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/result_codegen_gcc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
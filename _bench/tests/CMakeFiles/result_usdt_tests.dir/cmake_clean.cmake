@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_usdt_tests.dir/test_usdt.cpp.o"
+  "CMakeFiles/result_usdt_tests.dir/test_usdt.cpp.o.d"
+  "result_usdt_tests"
+  "result_usdt_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_usdt_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
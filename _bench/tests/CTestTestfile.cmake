@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_bench/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(result_tests "/root/repo/_bench/tests/result_tests")
+set_tests_properties(result_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;44;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_expect_tests "/root/repo/_bench/tests/result_expect_tests")
+set_tests_properties(result_expect_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;48;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_backtrace_tests "/root/repo/_bench/tests/result_backtrace_tests")
+set_tests_properties(result_backtrace_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;52;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_site_counters_tests "/root/repo/_bench/tests/result_site_counters_tests")
+set_tests_properties(result_site_counters_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;75;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_timed_tests "/root/repo/_bench/tests/result_timed_tests")
+set_tests_properties(result_timed_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;89;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_niche_tests "/root/repo/_bench/tests/result_niche_tests")
+set_tests_properties(result_niche_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;98;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_ptr_result_tests "/root/repo/_bench/tests/result_ptr_result_tests")
+set_tests_properties(result_ptr_result_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;102;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_expected_tests "/root/repo/_bench/tests/result_expected_tests")
+set_tests_properties(result_expected_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;108;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_usdt_tests "/root/repo/_bench/tests/result_usdt_tests")
+set_tests_properties(result_usdt_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;39;add_test;/root/repo/tests/CMakeLists.txt;119;result_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_usdt_notes "/usr/bin/cmake" "-DREADELF=/usr/bin/readelf" "-DBINARY=/root/repo/_bench/tests/result_usdt_tests" "-P" "/root/repo/tests/check_usdt_notes.cmake")
+set_tests_properties(result_usdt_notes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;131;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(result_codegen_gcc "/usr/bin/cmake" "-DOBJDUMP=/usr/bin/objdump" "-DOBJECT=/root/repo/_bench/tests/result_codegen_gcc.o" "-DSOURCE=/root/repo/tests/codegen/probes.cpp" "-P" "/root/repo/tests/codegen/check_codegen.cmake")
+set_tests_properties(result_codegen_gcc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;180;add_test;/root/repo/tests/CMakeLists.txt;201;result_add_codegen_check;/root/repo/tests/CMakeLists.txt;0;")
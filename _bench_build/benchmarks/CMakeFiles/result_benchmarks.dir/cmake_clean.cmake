@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_benchmarks.dir/bench_result.cpp.o"
+  "CMakeFiles/result_benchmarks.dir/bench_result.cpp.o.d"
+  "result_benchmarks"
+  "result_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_parse_time"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/result_parse_time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_backtrace_tests.dir/test_backtrace.cpp.o"
+  "CMakeFiles/result_backtrace_tests.dir/test_backtrace.cpp.o.d"
+  "result_backtrace_tests"
+  "result_backtrace_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_backtrace_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
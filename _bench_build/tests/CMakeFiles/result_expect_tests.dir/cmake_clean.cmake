@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_expect_tests.dir/test_expect.cpp.o"
+  "CMakeFiles/result_expect_tests.dir/test_expect.cpp.o.d"
+  "result_expect_tests"
+  "result_expect_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_expect_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
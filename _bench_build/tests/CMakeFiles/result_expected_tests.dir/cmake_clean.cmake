@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_expected_tests.dir/test_expected.cpp.o"
+  "CMakeFiles/result_expected_tests.dir/test_expected.cpp.o.d"
+  "result_expected_tests"
+  "result_expected_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_expected_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_mapped_file_tests.dir/test_mapped_file.cpp.o"
+  "CMakeFiles/result_mapped_file_tests.dir/test_mapped_file.cpp.o.d"
+  "result_mapped_file_tests"
+  "result_mapped_file_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_mapped_file_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_niche_tests.dir/test_niche.cpp.o"
+  "CMakeFiles/result_niche_tests.dir/test_niche.cpp.o.d"
+  "result_niche_tests"
+  "result_niche_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_niche_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_parse_tests.dir/test_parse.cpp.o"
+  "CMakeFiles/result_parse_tests.dir/test_parse.cpp.o.d"
+  "result_parse_tests"
+  "result_parse_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_parse_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_posix_tests.dir/test_posix.cpp.o"
+  "CMakeFiles/result_posix_tests.dir/test_posix.cpp.o.d"
+  "result_posix_tests"
+  "result_posix_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_posix_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_ptr_result_tests.dir/test_ptr_result.cpp.o"
+  "CMakeFiles/result_ptr_result_tests.dir/test_ptr_result.cpp.o.d"
+  "result_ptr_result_tests"
+  "result_ptr_result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_ptr_result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_site_counters_tests.dir/test_site_counters.cpp.o"
+  "CMakeFiles/result_site_counters_tests.dir/test_site_counters.cpp.o.d"
+  "result_site_counters_tests"
+  "result_site_counters_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_site_counters_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
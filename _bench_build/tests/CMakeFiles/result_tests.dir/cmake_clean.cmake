@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_tests.dir/test_result.cpp.o"
+  "CMakeFiles/result_tests.dir/test_result.cpp.o.d"
+  "result_tests"
+  "result_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
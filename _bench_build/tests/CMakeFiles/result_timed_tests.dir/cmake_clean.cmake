@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_timed_tests.dir/test_timed.cpp.o"
+  "CMakeFiles/result_timed_tests.dir/test_timed.cpp.o.d"
+  "result_timed_tests"
+  "result_timed_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_timed_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
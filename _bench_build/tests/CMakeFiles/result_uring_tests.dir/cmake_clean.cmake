@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/result_uring_tests.dir/test_uring.cpp.o"
+  "CMakeFiles/result_uring_tests.dir/test_uring.cpp.o.d"
+  "result_uring_tests"
+  "result_uring_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/result_uring_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_BENCHMARKS_BENCH_HARNESS_HPP_
+#define LRUSINGER_RESULT_BENCHMARKS_BENCH_HARNESS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal self-contained benchmark harness: each case is calibrated to a minimum run time, then
+// repeated and reported as the median nanoseconds per operation.
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+// Deterministic error pattern so that all variants see the same branch history.
+class error_pattern {
+   public:
+    static constexpr std::size_t size = 4096;
+
+    explicit error_pattern(unsigned percent) {
+        std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+        for (auto &fail : m_fail) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            fail = state % 100 < percent;
+        }
+    }
+
+    [[nodiscard]] bool operator[](std::size_t i) const noexcept { return m_fail[i % size]; }
+
+   private:
+    std::array<bool, size> m_fail{};
+};
+
+struct options {
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds(20);
+    std::size_t              repetitions = 5;
+    std::string              filter;
+};
+
+class runner {
+   public:
+    explicit runner(options opts) : m_opts(std::move(opts)) {
+        std::printf("%-28s %-10s %6s %12s\n", "workload", "variant", "err%", "ns/op");
+    }
+
+    // `body(n)` must perform `n` operations.
+    template <typename Body>
+    void run(const std::string &workload, const char *variant, unsigned err_percent, Body &&body) {
+        const auto name = workload + "/" + variant;
+        if (!m_opts.filter.empty() && name.find(m_opts.filter) == std::string::npos)
+            return;
+
+        std::size_t n = 64;
+        while (time(body, n) < m_opts.min_time && n < (std::size_t{1} << 32))
+            n *= 2;
+
+        std::vector<double> samples;
+        for (std::size_t i = 0; i < m_opts.repetitions; ++i)
+            samples.push_back(static_cast<double>(time(body, n).count()) /
+                              static_cast<double>(n));
+
+        std::sort(samples.begin(), samples.end());
+        std::printf("%-28s %-10s %6u %12.2f\n", workload.c_str(), variant, err_percent,
+                    samples[samples.size() / 2]);
+    }
+
+   private:
+    template <typename Body>
+    static std::chrono::nanoseconds time(Body &body, std::size_t n) {
+        const auto start = std::chrono::steady_clock::now();
+        body(n);
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    options m_opts;
+};
+
+}  // namespace bench
+
+#endif  // LRUSINGER_RESULT_BENCHMARKS_BENCH_HARNESS_HPP_
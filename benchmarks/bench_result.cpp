@@ -0,0 +1,407 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if __has_include(<expected>)
+#    include <expected>
+#endif
+
+#include "../include/result/parse.hpp"
+#include "../include/result/result.hpp"
+#include "bench_harness.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#    define RESULT_BENCH_HAS_EXPECTED
+#    include "../include/result/expected.hpp"
+#endif
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#    define RESULT_BENCH_HAS_EXCEPTIONS
+#endif
+
+// ================================================================================================
+// Error payloads
+// ================================================================================================
+
+enum class tiny_error : std::uint8_t { failed = 1 };
+
+struct medium_error {
+    std::uint64_t code;
+    std::uint64_t detail;
+};
+
+struct large_error {
+    std::array<std::uint64_t, 8> words;
+};
+
+template <typename E>
+struct error_info;
+
+template <>
+struct error_info<tiny_error> {
+    static constexpr const char *name = "1B";
+    static tiny_error            make() { return tiny_error::failed; }
+};
+
+template <>
+struct error_info<medium_error> {
+    static constexpr const char *name = "16B";
+    static medium_error          make() { return {1, 2}; }
+};
+
+template <>
+struct error_info<large_error> {
+    static constexpr const char *name = "64B";
+    static large_error           make() { return {{1, 2, 3, 4, 5, 6, 7, 8}}; }
+};
+
+// Long enough to defeat the small string optimization.
+template <>
+struct error_info<std::string> {
+    static constexpr const char *name = "string";
+    static std::string           make() { return "connection reset by peer (errno 104)"; }
+};
+
+// ================================================================================================
+// Leaf functions
+// ================================================================================================
+
+template <typename E>
+[[gnu::noinline]] Result<int, E> result_leaf(int x, bool fail) {
+    if (fail)
+        return Err(error_info<E>::make());
+
+    return Ok(x + 1);
+}
+
+template <typename E>
+[[gnu::noinline]] bool code_leaf(int x, bool fail, int *out, E *err) {
+    if (fail) {
+        *err = error_info<E>::make();
+        return false;
+    }
+
+    *out = x + 1;
+    return true;
+}
+
+#ifdef RESULT_BENCH_HAS_EXCEPTIONS
+template <typename E>
+[[gnu::noinline]] int exception_leaf(int x, bool fail) {
+    if (fail)
+        throw error_info<E>::make();
+
+    return x + 1;
+}
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+template <typename E>
+[[gnu::noinline]] std::expected<int, E> expected_leaf(int x, bool fail) {
+    if (fail)
+        return std::unexpected(error_info<E>::make());
+
+    return x + 1;
+}
+#endif
+
+// ================================================================================================
+// Propagation chains
+// ================================================================================================
+
+// Every frame is a real call that forwards the error or adds one to the value.
+template <typename E, std::size_t Depth>
+[[gnu::noinline]] Result<int, E> result_chain(int x, bool fail) {
+    if constexpr (Depth == 1) {
+        return result_leaf<E>(x, fail);
+    } else {
+        return result_chain<E, Depth - 1>(x, fail).and_then(
+            [](int v) -> Result<int, E> { return Ok(v + 1); });
+    }
+}
+
+template <typename E, std::size_t Depth>
+[[gnu::noinline]] bool code_chain(int x, bool fail, int *out, E *err) {
+    if constexpr (Depth == 1) {
+        return code_leaf<E>(x, fail, out, err);
+    } else {
+        if (!code_chain<E, Depth - 1>(x, fail, out, err))
+            return false;
+
+        *out += 1;
+        return true;
+    }
+}
+
+#ifdef RESULT_BENCH_HAS_EXCEPTIONS
+template <typename E, std::size_t Depth>
+[[gnu::noinline]] int exception_chain(int x, bool fail) {
+    if constexpr (Depth == 1) {
+        return exception_leaf<E>(x, fail);
+    } else {
+        return exception_chain<E, Depth - 1>(x, fail) + 1;
+    }
+}
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+template <typename E, std::size_t Depth>
+[[gnu::noinline]] std::expected<int, E> expected_chain(int x, bool fail) {
+    if constexpr (Depth == 1) {
+        return expected_leaf<E>(x, fail);
+    } else {
+#    if __cpp_lib_expected >= 202211L
+        return expected_chain<E, Depth - 1>(x, fail).and_then(
+            [](int v) -> std::expected<int, E> { return v + 1; });
+#    else
+        // Monadic operations arrived with P2505; propagate by hand on older libraries.
+        auto r = expected_chain<E, Depth - 1>(x, fail);
+        if (!r)
+            return std::unexpected(std::move(r).error());
+
+        return *r + 1;
+#    endif
+    }
+}
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+// A Result chain built from std::expected code: the leaf and every step return std::expected and
+// go through from_expected()/adapt_expected(), the caller receives a std::expected again.
+template <typename E, std::size_t Depth>
+[[gnu::noinline]] Result<int, E> interop_chain(int x, bool fail) {
+    if constexpr (Depth == 1) {
+        return from_expected(expected_leaf<E>(x, fail));
+    } else {
+        return interop_chain<E, Depth - 1>(x, fail).and_then(
+            adapt_expected([](int v) -> std::expected<int, E> { return v + 1; }));
+    }
+}
+#endif
+
+// Depth 0 calls the leaf directly.
+template <typename E, std::size_t Depth>
+Result<int, E> call_result(int x, bool fail) {
+    if constexpr (Depth == 0)
+        return result_leaf<E>(x, fail);
+    else
+        return result_chain<E, Depth>(x, fail);
+}
+
+template <typename E, std::size_t Depth>
+bool call_code(int x, bool fail, int *out, E *err) {
+    if constexpr (Depth == 0)
+        return code_leaf<E>(x, fail, out, err);
+    else
+        return code_chain<E, Depth>(x, fail, out, err);
+}
+
+#ifdef RESULT_BENCH_HAS_EXCEPTIONS
+template <typename E, std::size_t Depth>
+int call_exception(int x, bool fail) {
+    if constexpr (Depth == 0)
+        return exception_leaf<E>(x, fail);
+    else
+        return exception_chain<E, Depth>(x, fail);
+}
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+template <typename E, std::size_t Depth>
+std::expected<int, E> call_expected(int x, bool fail) {
+    if constexpr (Depth == 0)
+        return expected_leaf<E>(x, fail);
+    else
+        return expected_chain<E, Depth>(x, fail);
+}
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+template <typename E, std::size_t Depth>
+std::expected<int, E> call_interop(int x, bool fail) {
+    if constexpr (Depth == 0)
+        return to_expected(from_expected(expected_leaf<E>(x, fail)));
+    else
+        return to_expected(interop_chain<E, Depth>(x, fail));
+}
+#endif
+
+// ================================================================================================
+// Workloads
+// ================================================================================================
+
+// Runs one workload for every error-handling strategy.
+template <typename E, std::size_t Depth>
+void run_variants(bench::runner &runner, const std::string &workload, unsigned percent) {
+    const bench::error_pattern pattern(percent);
+
+    runner.run(workload, "result", percent, [&](std::size_t n) {
+        int sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto r = call_result<E, Depth>(static_cast<int>(i), pattern[i]);
+            sum += r.is_ok() ? r.unwrap_ref() : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    runner.run(workload, "errcode", percent, [&](std::size_t n) {
+        int sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            int out = 0;
+            E   err{};
+            sum += call_code<E, Depth>(static_cast<int>(i), pattern[i], &out, &err) ? out : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+#ifdef RESULT_BENCH_HAS_EXCEPTIONS
+    runner.run(workload, "exception", percent, [&](std::size_t n) {
+        int sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            try {
+                sum += call_exception<E, Depth>(static_cast<int>(i), pattern[i]);
+            } catch (const E &) {
+                sum -= 1;
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+#endif
+
+#ifdef RESULT_BENCH_HAS_EXPECTED
+    runner.run(workload, "expected", percent, [&](std::size_t n) {
+        int sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto r = call_expected<E, Depth>(static_cast<int>(i), pattern[i]);
+            sum += r.has_value() ? *r : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    runner.run(workload, "interop", percent, [&](std::size_t n) {
+        int sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            auto r = call_interop<E, Depth>(static_cast<int>(i), pattern[i]);
+            sum += r.has_value() ? *r : -1;
+        }
+        bench::do_not_optimize(sum);
+    });
+#endif
+}
+
+template <typename E>
+void run_return_path(bench::runner &runner) {
+    for (unsigned percent : {0U, 1U, 10U, 25U, 50U})
+        run_variants<E, 0>(runner, std::string{"return/"} + error_info<E>::name, percent);
+}
+
+template <typename E, std::size_t... Depths>
+void run_propagation(bench::runner &runner, std::index_sequence<Depths...>) {
+    for (unsigned percent : {0U, 10U, 50U}) {
+        (run_variants<E, Depths>(runner,
+                                 std::string{"chain"} + std::to_string(Depths) + "/" +
+                                     error_info<E>::name,
+                                 percent),
+         ...);
+    }
+}
+
+// ================================================================================================
+// Numeric parsing
+// ================================================================================================
+
+// parse<std::uint64_t> against plain std::from_chars on a column of `digits`-digit numbers, of
+// which `percent` % carry a stray character.
+void run_parse(bench::runner &runner, unsigned digits) {
+    for (unsigned percent : {0U, 10U}) {
+        const bench::error_pattern pattern(percent);
+        std::vector<std::string>   fields(bench::error_pattern::size);
+        std::string                column;
+
+        std::uint64_t state = 0x2545f4914f6cdd1dULL;
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            for (unsigned d = 0; d < digits; ++d) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                fields[i] += static_cast<char>('1' + (state >> 60) % 9);
+            }
+
+            if (pattern[i])
+                fields[i][digits / 2] = 'x';
+
+            column += fields[i];
+            column += ',';
+        }
+
+        const std::string workload = "parse/u64/" + std::to_string(digits);
+
+        runner.run(workload, "result", percent, [&](std::size_t n) {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                sum += parse<std::uint64_t>(fields[i % fields.size()]).unwrap_or(0);
+            bench::do_not_optimize(sum);
+        });
+
+        runner.run(workload, "from_chars", percent, [&](std::size_t n) {
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::string &field = fields[i % fields.size()];
+                std::uint64_t      value = 0;
+                const auto [ptr, ec] =
+                    std::from_chars(field.data(), field.data() + field.size(), value);
+                sum += ec == std::errc() && ptr == field.data() + field.size() ? value : 0;
+            }
+            bench::do_not_optimize(sum);
+        });
+
+        // One op per field.
+        std::vector<std::uint64_t> out(fields.size());
+        std::vector<std::uint64_t> failures(failure_bitmap_words(fields.size()));
+
+        runner.run(workload, "column", percent, [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; i += fields.size())
+                bench::do_not_optimize(parse_column<std::uint64_t>(
+                    column, ',', out.data(), failures.data(), out.size()));
+        });
+    }
+}
+
+// Usage: result_benchmarks [--filter=<substring>] [--min-time-ms=<n>] [--repetitions=<n>]
+int main(int argc, char **argv) {
+    bench::options opts;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0)
+            opts.filter = arg + 9;
+        else if (std::strncmp(arg, "--min-time-ms=", 14) == 0)
+            opts.min_time = std::chrono::milliseconds(std::atoi(arg + 14));
+        else if (std::strncmp(arg, "--repetitions=", 14) == 0)
+            opts.repetitions = static_cast<std::size_t>(std::max(1, std::atoi(arg + 14)));
+    }
+
+    bench::runner runner(opts);
+
+    run_return_path<tiny_error>(runner);
+    run_return_path<medium_error>(runner);
+    run_return_path<large_error>(runner);
+    run_return_path<std::string>(runner);
+
+    run_propagation<tiny_error>(runner, std::index_sequence<1, 2, 4, 8, 16, 32>{});
+    run_propagation<std::string>(runner, std::index_sequence<1, 2, 4, 8, 16, 32>{});
+
+    for (unsigned digits : {4U, 8U, 16U})
+        run_parse(runner, digits);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+// Compile-time benchmark for automatic enum sentinel discovery.
+//
+// Instantiates the sentinel search for 64 dense 1-byte enums, whose first free value is 48, and
+// 64 4-byte enums. Compare compile times (or -ftime-report / -ftime-trace output) across changes:
+//
+//     time c++ -std=c++17 -fsyntax-only benchmarks/compile_time_enum_sentinels.cpp
+
+#include <cstdint>
+
+#include "../include/result/result.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// 48 named enumerators, so the exhaustive 1-byte scan has to skip 48 values.
+#define RESULT_BENCH_ENUMERATORS                                \
+    v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11,           \
+    v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, \
+    v24, v25, v26, v27, v28, v29, v30, v31, v32, v33, v34, v35, \
+    v36, v37, v38, v39, v40, v41, v42, v43, v44, v45, v46, v47
+
+#define RESULT_BENCH_ENUM_PAIR(n)                                                  \
+    enum class small_enum_##n : std::uint8_t { RESULT_BENCH_ENUMERATORS };         \
+    enum class big_enum_##n : std::uint32_t { RESULT_BENCH_ENUMERATORS };          \
+    static_assert(sizeof(Result<void, small_enum_##n>) == sizeof(small_enum_##n)); \
+    static_assert(sizeof(Result<void, big_enum_##n>) == sizeof(big_enum_##n));
+
+#define RESULT_BENCH_ENUM_PAIRS_8(n) \
+    RESULT_BENCH_ENUM_PAIR(n##0)     \
+    RESULT_BENCH_ENUM_PAIR(n##1)     \
+    RESULT_BENCH_ENUM_PAIR(n##2)     \
+    RESULT_BENCH_ENUM_PAIR(n##3)     \
+    RESULT_BENCH_ENUM_PAIR(n##4)     \
+    RESULT_BENCH_ENUM_PAIR(n##5)     \
+    RESULT_BENCH_ENUM_PAIR(n##6)     \
+    RESULT_BENCH_ENUM_PAIR(n##7)
+
+RESULT_BENCH_ENUM_PAIRS_8(0)
+RESULT_BENCH_ENUM_PAIRS_8(1)
+RESULT_BENCH_ENUM_PAIRS_8(2)
+RESULT_BENCH_ENUM_PAIRS_8(3)
+RESULT_BENCH_ENUM_PAIRS_8(4)
+RESULT_BENCH_ENUM_PAIRS_8(5)
+RESULT_BENCH_ENUM_PAIRS_8(6)
+RESULT_BENCH_ENUM_PAIRS_8(7)
+
+static_assert(static_cast<int>(tiny::impl::automatic_enum_sentinel<small_enum_00>) == 48);
@@ -0,0 +1,90 @@
+# Measures the per-translation-unit cost of using the library in four ways:
+#   include  a TU that includes result.hpp,
+#   core     a TU that includes only the lean core.hpp,
+#   pch      the same TU with result.hpp precompiled (built once, not timed),
+#   module   a TU that imports lsr.result (interface built once, not timed).
+# Each TU is compiled RUNS times with -c; the median wall time is reported.
+#
+# Usage: cmake -DCXX=<compiler> -DCXX_ID=<GNU|Clang> -DSOURCE_DIR=<repo> -DWORK_DIR=<dir>
+#              [-DRUNS=5] -P measure_parse_time.cmake
+
+if(NOT RUNS)
+    set(RUNS 5)
+endif()
+
+set(include_dir ${SOURCE_DIR}/include)
+set(common_flags -std=c++20 -I${include_dir})
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR}/pch)
+
+file(WRITE ${WORK_DIR}/include.cpp "#include <result/result.hpp>\nint main() { return 0; }\n")
+file(WRITE ${WORK_DIR}/core.cpp "#include <result/core.hpp>\nint main() { return 0; }\n")
+file(WRITE ${WORK_DIR}/pch.cpp "int main() { return 0; }\n")
+file(WRITE ${WORK_DIR}/import.cpp "import lsr.result;\nint main() { return 0; }\n")
+
+function(median_ms out)
+    set(samples "")
+
+    foreach(run RANGE 1 ${RUNS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(COMMAND ${ARGN} WORKING_DIRECTORY ${WORK_DIR} RESULT_VARIABLE status
+                        OUTPUT_QUIET ERROR_VARIABLE errors)
+        string(TIMESTAMP stop "%s%f")
+
+        if(NOT status EQUAL 0)
+            set(${out} "failed" PARENT_SCOPE)
+            message(STATUS "${errors}")
+            return()
+        endif()
+
+        math(EXPR elapsed "(${stop} - ${start}) / 1000")
+        list(APPEND samples ${elapsed})
+    endforeach()
+
+    list(SORT samples COMPARE NATURAL)
+    math(EXPR middle "${RUNS} / 2")
+    list(GET samples ${middle} median)
+    set(${out} "${median} ms" PARENT_SCOPE)
+endfunction()
+
+# precompiled header and module interface, built once
+if(CXX_ID STREQUAL "GNU")
+    set(pch_build ${CXX} ${common_flags} -x c++-header ${include_dir}/result/result.hpp
+                  -o ${WORK_DIR}/pch/result.hpp.gch)
+    set(pch_use -include ${WORK_DIR}/pch/result.hpp -Winvalid-pch)
+    set(module_build ${CXX} ${common_flags} -fmodules-ts -c -x c++
+                     ${SOURCE_DIR}/modules/result.cppm -o ${WORK_DIR}/module.o)
+    set(module_use -fmodules-ts)
+elseif(CXX_ID MATCHES "Clang")
+    set(pch_build ${CXX} ${common_flags} -x c++-header ${include_dir}/result/result.hpp
+                  -o ${WORK_DIR}/pch/result.pch)
+    set(pch_use -include-pch ${WORK_DIR}/pch/result.pch)
+    set(module_build ${CXX} ${common_flags} --precompile -x c++-module
+                     ${SOURCE_DIR}/modules/result.cppm -o ${WORK_DIR}/lsr.result.pcm)
+    set(module_use -fmodule-file=lsr.result=${WORK_DIR}/lsr.result.pcm)
+else()
+    message(FATAL_ERROR "measure_parse_time.cmake supports GCC and Clang, not ${CXX_ID}")
+endif()
+
+execute_process(COMMAND ${pch_build} WORKING_DIRECTORY ${WORK_DIR} RESULT_VARIABLE pch_status)
+execute_process(COMMAND ${module_build} WORKING_DIRECTORY ${WORK_DIR} RESULT_VARIABLE module_status)
+
+median_ms(include_ms ${CXX} ${common_flags} -c include.cpp -o include.o)
+median_ms(core_ms ${CXX} ${common_flags} -c core.cpp -o core.o)
+
+set(pch_ms "unavailable")
+if(pch_status EQUAL 0)
+    median_ms(pch_ms ${CXX} ${common_flags} ${pch_use} -c pch.cpp -o pch.o)
+endif()
+
+set(module_ms "unavailable")
+if(module_status EQUAL 0)
+    median_ms(module_ms ${CXX} ${common_flags} ${module_use} -c import.cpp -o import.o)
+endif()
+
+message(STATUS "per-TU compile time, median of ${RUNS} (${CXX_ID})")
+message(STATUS "  #include <result/result.hpp>  ${include_ms}")
+message(STATUS "  #include <result/core.hpp>    ${core_ms}")
+message(STATUS "  precompiled header            ${pch_ms}")
+message(STATUS "  import lsr.result;            ${module_ms}")
@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_BACKTRACE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_BACKTRACE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef RESULT_ENABLE_ERR_BACKTRACE
+#    include <ostream>
+#endif
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+// =================================================================================================
+// Configuration
+// =================================================================================================
+
+// RESULT_TRACED_ERR(e) behaves like Err(e). With RESULT_ENABLE_ERR_BACKTRACE defined, every N-th
+// evaluation of a given call site on a given thread additionally records the call stack into a
+// fixed-size ring buffer. The sampling counters are thread-local, so a hot error path does not
+// bounce a shared cache line between cores. Frames are found by walking frame pointers (no
+// unwinder, no allocation), so translation units that record backtraces should be compiled with
+// -fno-omit-frame-pointer. Addresses are only symbolized when the ring buffer is printed.
+
+#ifndef RESULT_ERR_BACKTRACE_SAMPLE_RATE
+#    define RESULT_ERR_BACKTRACE_SAMPLE_RATE 64
+#endif
+
+#ifndef RESULT_ERR_BACKTRACE_DEPTH
+#    define RESULT_ERR_BACKTRACE_DEPTH 16
+#endif
+
+#ifndef RESULT_ERR_BACKTRACE_CAPACITY
+#    define RESULT_ERR_BACKTRACE_CAPACITY 64
+#endif
+
+#if defined(RESULT_ENABLE_ERR_BACKTRACE) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#    define RESULT_ERR_BACKTRACE_FRAME_WALK
+#endif
+
+#if defined(RESULT_ENABLE_ERR_BACKTRACE) && __has_include(<dlfcn.h>)
+#    include <dlfcn.h>
+#    define RESULT_ERR_BACKTRACE_DLADDR
+#endif
+
+#if defined(RESULT_ENABLE_ERR_BACKTRACE) && __has_include(<cxxabi.h>)
+#    include <cxxabi.h>
+#    define RESULT_ERR_BACKTRACE_DEMANGLE
+#endif
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Recorded backtrace
+// =================================================================================================
+
+struct err_backtrace {
+    const char                                    *file;
+    int                                            line;
+    std::uint32_t                                  depth;
+    std::array<void *, RESULT_ERR_BACKTRACE_DEPTH> frames;
+};
+
+namespace detail {
+
+// =================================================================================================
+// Call site and ring buffer storage
+// =================================================================================================
+
+struct err_backtrace_site {
+    const char   *file;
+    int           line;
+    std::uint32_t rate;
+};
+
+// Slots are guarded by a sequence number: 2 * ticket + 1 while the writer owning `ticket` fills
+// the slot, 2 * ticket + 2 once it is published. A writer that finds the slot busy drops its
+// sample instead of waiting.
+struct err_backtrace_slot {
+    std::atomic<std::uint64_t>                                  seq{0};
+    std::atomic<const err_backtrace_site *>                     site{nullptr};
+    std::atomic<std::uint32_t>                                  depth{0};
+    std::array<std::atomic<void *>, RESULT_ERR_BACKTRACE_DEPTH> frames{};
+};
+
+struct err_backtrace_ring {
+    std::atomic<std::uint64_t>                                    next{0};
+    std::array<err_backtrace_slot, RESULT_ERR_BACKTRACE_CAPACITY> slots{};
+};
+
+inline err_backtrace_ring err_backtraces{};
+
+// =================================================================================================
+// Capture
+// =================================================================================================
+
+#ifdef RESULT_ERR_BACKTRACE_FRAME_WALK
+// Walks the frame-pointer chain, dropping the innermost `skip` return addresses. Both x86-64 and
+// AArch64 keep the previous frame pointer at [fp] and the return address at [fp + 1 word]. The
+// walk stops at the first frame that does not move strictly up the stack by a plausible amount,
+// which also ends it gracefully when a frame was compiled without frame pointers.
+__attribute__((noinline, no_sanitize_address)) inline std::uint32_t capture_frames(
+    void **out, std::uint32_t max, std::uint32_t skip) noexcept {
+    constexpr std::uintptr_t max_frame_size = std::uintptr_t{1} << 20;
+
+    auto         **fp = static_cast<void **>(__builtin_frame_address(0));
+    std::uint32_t depth = 0;
+
+    while (fp != nullptr && depth < max) {
+        void *const ret = fp[1];
+        if (ret == nullptr)
+            break;
+
+        if (skip == 0)
+            out[depth++] = ret;
+        else
+            --skip;
+
+        auto **const next = static_cast<void **>(fp[0]);
+        const auto   from = reinterpret_cast<std::uintptr_t>(fp);
+        const auto   to = reinterpret_cast<std::uintptr_t>(next);
+
+        if (to <= from || to - from > max_frame_size || to % alignof(void *) != 0)
+            break;
+
+        fp = next;
+    }
+
+    return depth;
+}
+#else
+inline std::uint32_t capture_frames(void **, std::uint32_t, std::uint32_t) noexcept { return 0; }
+#endif
+
+[[gnu::cold]] [[gnu::noinline]] inline void record_err_backtrace(
+    const err_backtrace_site &site) noexcept {
+    std::array<void *, RESULT_ERR_BACKTRACE_DEPTH> frames;
+
+    // Skip our own frame so that the first frame is the Err call site.
+    const std::uint32_t depth = capture_frames(frames.data(), RESULT_ERR_BACKTRACE_DEPTH, 1);
+
+    auto               &ring = err_backtraces;
+    const std::uint64_t ticket = ring.next.fetch_add(1, std::memory_order_relaxed);
+    auto               &slot = ring.slots[ticket % RESULT_ERR_BACKTRACE_CAPACITY];
+
+    std::uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq & 1U) != 0 ||
+        !slot.seq.compare_exchange_strong(seq, 2 * ticket + 1, std::memory_order_relaxed))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.site.store(&site, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+    for (std::uint32_t i = 0; i < depth; ++i)
+        slot.frames[i].store(frames[i], std::memory_order_relaxed);
+
+    slot.seq.store(2 * ticket + 2, std::memory_order_release);
+}
+
+// `hits` is the calling thread's counter for this site.
+inline void sample_err_backtrace(const err_backtrace_site &site, std::uint32_t &hits) noexcept {
+    if (hits++ % site.rate == 0)
+        record_err_backtrace(site);
+}
+
+// =================================================================================================
+// Symbolization
+// =================================================================================================
+
+#ifdef RESULT_ENABLE_ERR_BACKTRACE
+inline void print_err_backtrace_frame(std::ostream &os, std::size_t index, void *pc) {
+    os << "  #" << index << ' ' << pc;
+
+#ifdef RESULT_ERR_BACKTRACE_DLADDR
+    // Return addresses point behind the call; look up the call instruction itself.
+    Dl_info info{};
+    if (dladdr(static_cast<char *>(pc) - 1, &info) != 0) {
+        if (info.dli_sname != nullptr) {
+            const char *name = info.dli_sname;
+#    ifdef RESULT_ERR_BACKTRACE_DEMANGLE
+            int   status = 0;
+            char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+            if (status == 0 && demangled != nullptr)
+                name = demangled;
+#    endif
+            os << ' ' << name << "+0x" << std::hex
+               << (static_cast<char *>(pc) - static_cast<char *>(info.dli_saddr)) << std::dec;
+#    ifdef RESULT_ERR_BACKTRACE_DEMANGLE
+            std::free(demangled);
+#    endif
+        }
+
+        if (info.dli_fname != nullptr)
+            os << " (" << info.dli_fname << ')';
+    }
+#endif
+
+    os << '\n';
+}
+#endif
+
+}  // namespace detail
+
+// =================================================================================================
+// Inspection
+// =================================================================================================
+
+// Calls fn(const err_backtrace &) for every published record, oldest first. Records that are being
+// overwritten concurrently are skipped.
+template <typename Fn>
+void visit_err_backtraces(Fn &&fn) {
+    auto               &ring = detail::err_backtraces;
+    const std::uint64_t end = ring.next.load(std::memory_order_acquire);
+    const std::uint64_t begin =
+        end > RESULT_ERR_BACKTRACE_CAPACITY ? end - RESULT_ERR_BACKTRACE_CAPACITY : 0;
+
+    for (std::uint64_t ticket = begin; ticket < end; ++ticket) {
+        const auto &slot = ring.slots[ticket % RESULT_ERR_BACKTRACE_CAPACITY];
+
+        if (slot.seq.load(std::memory_order_acquire) != 2 * ticket + 2)
+            continue;
+
+        err_backtrace out{};
+        const auto   *site = slot.site.load(std::memory_order_relaxed);
+        out.depth = slot.depth.load(std::memory_order_relaxed);
+        for (std::uint32_t i = 0; i < out.depth; ++i)
+            out.frames[i] = slot.frames[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != 2 * ticket + 2 || site == nullptr)
+            continue;
+
+        out.file = site->file;
+        out.line = site->line;
+        fn(static_cast<const err_backtrace &>(out));
+    }
+}
+
+// Only with RESULT_ENABLE_ERR_BACKTRACE, so that other includers do not pay for <ostream>.
+#ifdef RESULT_ENABLE_ERR_BACKTRACE
+inline void dump_err_backtraces(std::ostream &os) {
+    visit_err_backtraces([&os](const err_backtrace &bt) {
+        os << "Err created at " << bt.file << ':' << bt.line << '\n';
+
+        for (std::uint32_t i = 0; i < bt.depth; ++i)
+            detail::print_err_backtrace_frame(os, i, bt.frames[i]);
+    });
+}
+#endif
+
+// Forgets all recorded backtraces. Not safe against concurrent recording.
+inline void clear_err_backtraces() noexcept {
+    auto &ring = detail::err_backtraces;
+
+    for (auto &slot : ring.slots)
+        slot.seq.store(0, std::memory_order_relaxed);
+
+    ring.next.store(0, std::memory_order_release);
+}
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+// =================================================================================================
+// Macros
+// =================================================================================================
+
+#ifdef RESULT_ENABLE_ERR_BACKTRACE
+#    define RESULT_TRACED_ERR_N(e, n)                                                           \
+        ([&]() {                                                                                \
+            static_assert((n) > 0, "The backtrace sample rate must be greater than zero.");     \
+            static const RESULT_NS::detail::err_backtrace_site result_traced_err_site_{         \
+                __FILE__, __LINE__, (n)};                                                       \
+            static thread_local std::uint32_t result_traced_err_hits_ = 0;                      \
+            RESULT_NS::detail::sample_err_backtrace(result_traced_err_site_,                    \
+                                                    result_traced_err_hits_);                   \
+            return RESULT_NS::Err(e);                                                           \
+        }())
+#else
+#    define RESULT_TRACED_ERR_N(e, n) RESULT_NS::Err(e)
+#endif
+
+#define RESULT_TRACED_ERR(e) RESULT_TRACED_ERR_N(e, RESULT_ERR_BACKTRACE_SAMPLE_RATE)
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_BACKTRACE_HPP_
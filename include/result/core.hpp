@@ -0,0 +1,2044 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_CORE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_CORE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "detail/optional.hpp"
+#include "detail/usdt.hpp"
+#include "niche.hpp"
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+#    error "Result<T, E> implementation requires C++17 or later."
+#endif
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_concepts) && __has_include(<compare>)
+#    include <compare>
+#endif
+
+#if defined(__cpp_lib_three_way_comparison) && defined(__cpp_lib_concepts)
+#    define RESULT_THREE_WAY_COMPARISON
+#endif
+
+// =================================================================================================
+// Version
+// =================================================================================================
+
+#define CPP_RESULT_VERSION_MAJOR 0
+#define CPP_RESULT_VERSION_MINOR 1
+#define CPP_RESULT_VERSION_PATCH 0
+
+#define CPP_RESULT_VERSION_STRING "0.1.0"
+
+#define CPP_RESULT_VERSION_ENCODE(major, minor, patch) \
+    (((major) * 10000) + ((minor) * 100) + (patch))
+
+#define CPP_RESULT_VERSION                                                        \
+    CPP_RESULT_VERSION_ENCODE(CPP_RESULT_VERSION_MAJOR, CPP_RESULT_VERSION_MINOR, \
+                              CPP_RESULT_VERSION_PATCH)
+
+// Reports through stdio rather than iostreams: <iostream> costs every includer its parse time
+// and a static initializer.
+#define RESULT_ERROR(_m)                                          \
+    do {                                                          \
+        const char *result_error_message_ = (_m);                 \
+        RESULT_USDT_PROBE1(result, panic, result_error_message_); \
+        std::fprintf(stderr, "%s\n", result_error_message_);      \
+        std::terminate();                                         \
+    } while (0)
+
+// Optimizer hint for invariants the caller has already checked.
+#if defined(__GNUC__) || defined(__clang__)
+#    define RESULT_ASSUME(_c)            \
+        do {                             \
+            if (!(_c))                   \
+                __builtin_unreachable(); \
+        } while (0)
+#elif defined(_MSC_VER)
+#    define RESULT_ASSUME(_c) __assume(_c)
+#else
+#    define RESULT_ASSUME(_c) static_cast<void>(0)
+#endif
+
+// Keeps failure paths out of line and out of the hot code layout.
+#if defined(__GNUC__) || defined(__clang__)
+#    define RESULT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#    define RESULT_COLD __declspec(noinline)
+#else
+#    define RESULT_COLD
+#endif
+
+// Qualifier for library names used inside macros that expand in user code.
+#ifdef RESULT_NAMESPACE
+#    define RESULT_NS ::lsr::result
+#else
+#    define RESULT_NS
+#endif
+
+// =================================================================================================
+// Instrumentation hooks
+// =================================================================================================
+
+// In counting builds Err() and unwrap() take a defaulted call_site parameter that captures the
+// caller's location. Without RESULT_ENABLE_SITE_COUNTERS the macros expand to nothing and the
+// functions keep their plain signatures, so no argument is built even in unoptimized code.
+#ifdef RESULT_ENABLE_SITE_COUNTERS
+#    include "site_counters.hpp"
+
+#    define RESULT_SITE_PARAM \
+        RESULT_NS::detail::call_site site = RESULT_NS::detail::call_site::current()
+#    define RESULT_SITE_NEXT_PARAM  , RESULT_SITE_PARAM
+#    define RESULT_COUNT_ERR()      RESULT_NS::detail::count_site_err(site)
+#    define RESULT_COUNT_UNWRAP(ok) RESULT_NS::detail::count_site_unwrap(site, (ok))
+#else
+#    define RESULT_SITE_PARAM
+#    define RESULT_SITE_NEXT_PARAM
+#    define RESULT_COUNT_ERR()      static_cast<void>(0)
+#    define RESULT_COUNT_UNWRAP(ok) static_cast<void>(0)
+#endif
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+template <typename T, typename E, auto OkSentinel = tiny::UseDefaultValue,
+          auto ErrSentinel = tiny::UseDefaultValue>
+class Result;
+
+// =================================================================================================
+// Wrapper types
+// =================================================================================================
+
+namespace wrapper {
+
+// =================================================================================================
+// Ok
+// =================================================================================================
+
+template <typename T>
+struct Ok {
+    using value_type = T;
+    explicit Ok(const T &v) : value(v) {}
+    explicit Ok(T &&v) : value(std::move(v)) {}
+
+    T value;
+};
+
+template <typename T>
+struct Ok<T &> {
+    using value_type = T &;
+    explicit Ok(T &v) noexcept : value(detail::address_of(v)) {}
+
+    T *value;
+};
+
+template <>
+struct Ok<void> {};
+
+// =================================================================================================
+// Err
+// =================================================================================================
+
+template <typename E>
+struct Err {
+    using value_type = E;
+    explicit Err(const E &e) : value(e) {}
+    explicit Err(E &&e) : value(std::move(e)) {}
+
+    E value;
+};
+
+template <typename E>
+struct Err<E &> {
+    using value_type = E &;
+    explicit Err(E &e) noexcept : value(detail::address_of(e)) {}
+
+    E *value;
+};
+
+template <>
+struct Err<void> {};
+
+}  // namespace wrapper
+
+template <typename T>
+[[maybe_unused]] inline auto Ok(T &&ok) {
+    using U = std::conditional_t<std::is_lvalue_reference_v<T>, T, std::decay_t<T>>;
+    return wrapper::Ok<U>(std::forward<T>(ok));
+}
+
+template <typename E>
+[[maybe_unused]] inline auto Err(E &&err RESULT_SITE_NEXT_PARAM) {
+    using U = std::conditional_t<std::is_lvalue_reference_v<E>, E, std::decay_t<E>>;
+    RESULT_COUNT_ERR();
+    return wrapper::Err<U>(std::forward<E>(err));
+}
+
+[[maybe_unused]] inline auto Ok() { return wrapper::Ok<void>{}; }
+
+[[maybe_unused]] inline auto Err(RESULT_SITE_PARAM) {
+    RESULT_COUNT_ERR();
+    return wrapper::Err<void>{};
+}
+
+// =================================================================================================
+// Helper functionality
+// =================================================================================================
+
+namespace detail {
+
+template <typename X>
+struct is_result : std::false_type {};
+
+template <typename T, typename E, auto OS, auto ES>
+struct is_result<Result<T, E, OS, ES>> : std::true_type {};
+
+template <typename X>
+struct destruct_result;
+
+template <typename T, typename E, auto OS, auto ES>
+struct destruct_result<Result<T, E, OS, ES>> {
+    using ok_type [[maybe_unused]] = T;
+    using err_type [[maybe_unused]] = E;
+};
+
+template <typename T>
+using nonvoid_value_t [[maybe_unused]] = std::enable_if_t<!std::is_void_v<T>, T>;
+
+template <typename T>
+using nonvoid_ref_t [[maybe_unused]] = std::enable_if_t<!std::is_void_v<T>, T &>;
+
+template <typename T>
+using nonvoid_cref_t [[maybe_unused]] = std::enable_if_t<!std::is_void_v<T>, const T &>;
+
+// Failure paths of expect(). The message is passed through untouched, so the success path neither
+// copies nor measures it.
+[[noreturn]] RESULT_COLD inline void expect_failed(const char *message) noexcept {
+    RESULT_ERROR(message);
+}
+
+[[noreturn]] RESULT_COLD inline void expect_failed(std::string_view message) noexcept {
+    // The panic probe takes a C string, and a string_view need not be terminated.
+    char        probe_message[256];
+    std::size_t length = message.size() < sizeof(probe_message) ? message.size()
+                                                                 : sizeof(probe_message) - 1;
+
+    if (length != 0)
+        std::memcpy(probe_message, message.data(), length);
+
+    probe_message[length] = '\0';
+    RESULT_USDT_PROBE1(result, panic, probe_message);
+    static_cast<void>(probe_message);
+
+    std::fprintf(stderr, "%.*s\n", static_cast<int>(message.size()), message.data());
+    std::terminate();
+}
+
+// std::invoke without <functional>.
+using tiny::impl::invoke;
+
+// =================================================================================================
+// Hashing and ordering
+// =================================================================================================
+
+// The value a side is compared and hashed by: references stand for their referent, as in
+// operator==.
+template <typename T>
+using side_value_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+using side_hash_result_t =
+    decltype(std::hash<side_value_t<T>>{}(std::declval<const side_value_t<T> &>()));
+
+// Detection traits are class templates: GCC 12 drops partial specializations of variable
+// templates across a module import, which would give importers of lsr.result different answers.
+template <typename T, typename = void>
+struct is_hashable : std::false_type {};
+
+template <typename T>
+struct is_hashable<T, std::void_t<side_hash_result_t<T>>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_hashable_v = is_hashable<T>::value;
+
+template <typename T>
+inline constexpr bool side_hashable_v = std::is_void_v<T> || is_hashable_v<T>;
+
+template <typename T>
+std::size_t hash_side(const T &value) {
+    return std::hash<side_value_t<T>>{}(value);
+}
+
+// Mixed into the hash of the error side, so that Ok(x) and Err(x) do not share a bucket.
+inline constexpr std::size_t err_hash_salt = static_cast<std::size_t>(0x9e3779b97f4a7c15ULL);
+
+// Backs std::hash<Result<T, E>>; disabled, like std::hash<std::optional<T>>, unless both sides are
+// hashable.
+template <typename R,
+          bool = side_hashable_v<typename destruct_result<R>::ok_type> &&
+                 side_hashable_v<typename destruct_result<R>::err_type>>
+struct result_hash {
+    result_hash() = delete;
+    result_hash(const result_hash &) = delete;
+    result_hash &operator=(const result_hash &) = delete;
+};
+
+template <typename R>
+struct result_hash<R, true> {
+    std::size_t operator()(const R &r) const {
+        using T = typename destruct_result<R>::ok_type;
+        using E = typename destruct_result<R>::err_type;
+
+        if constexpr (std::is_void_v<T> && std::is_void_v<E>) {
+            return r.is_ok() ? 0 : err_hash_salt;
+        } else if constexpr (std::is_void_v<E> && !std::is_reference_v<T>) {
+            return hash_optional<T>(r.m_ok);
+        } else if constexpr (std::is_void_v<T> && !std::is_reference_v<E>) {
+            return hash_optional<E>(r.m_err);
+        } else if constexpr (std::is_void_v<E>) {
+            return r.is_ok() ? hash_side(r.unwrap_ref()) : 0;
+        } else if constexpr (std::is_void_v<T>) {
+            return r.is_ok() ? 0 : hash_side(r.unwrap_err_ref());
+        } else {
+            return r.is_ok() ? hash_side(r.unwrap_ref())
+                             : err_hash_salt ^ hash_side(r.unwrap_err_ref());
+        }
+    }
+
+   private:
+    // A niche-packed scalar holds a T in either state: the niche is a value no payload takes, so
+    // hashing the raw word is branch-free, exactly as cheap as std::hash<T>, and still puts every
+    // empty result into one bucket. Anything else goes through the tiny::optional hash.
+    template <typename T, typename Optional>
+    static std::size_t hash_optional(const Optional &optional) {
+        if constexpr (std::is_scalar_v<T> && sizeof(Optional) == sizeof(T)) {
+            T raw;
+            std::memcpy(static_cast<void *>(&raw), static_cast<const void *>(&optional), sizeof(T));
+            return std::hash<T>{}(raw);
+        } else {
+            return std::hash<Optional>{}(optional);
+        }
+    }
+};
+
+#ifdef RESULT_THREE_WAY_COMPARISON
+template <typename T>
+using side_ordering_t = std::compare_three_way_result_t<side_value_t<T>>;
+
+// Ok orders before Err, as in Rust.
+template <typename Ordering>
+constexpr Ordering order_by_state(bool lhs_ok) noexcept {
+    return lhs_ok ? Ordering(std::strong_ordering::less) : Ordering(std::strong_ordering::greater);
+}
+#endif
+
+// =================================================================================================
+// Stored type resolve
+// =================================================================================================
+
+template <typename T>
+struct stored_type {
+    using type = T;
+};
+
+template <typename T>
+struct stored_type<T &> {
+    using type = T *;
+};
+
+template <typename T>
+using stored_type_t = typename stored_type<T>::type;
+
+template <typename T>
+[[maybe_unused]] inline constexpr bool is_ref_v = std::is_lvalue_reference_v<T>;
+
+template <typename T>
+[[maybe_unused]] inline stored_type_t<T> store_value(T value) {
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        return detail::address_of(value);
+    } else {
+        return std::move(value);
+    }
+}
+
+// =================================================================================================
+// Reference handling
+// =================================================================================================
+
+template <typename T>
+[[maybe_unused]] inline T unwrap_stored(stored_type_t<T> &value) {
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        return *value;
+    } else {
+        return std::move(value);
+    }
+}
+
+template <typename T>
+[[maybe_unused]] inline std::add_lvalue_reference_t<std::remove_reference_t<T>> unwrap_stored_ref(
+    stored_type_t<T> &value) {
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        return *value;
+    } else {
+        return value;
+    }
+}
+
+template <typename T>
+[[maybe_unused]] inline std::add_lvalue_reference_t<const std::remove_reference_t<T>>
+unwrap_stored_cref(const stored_type_t<T> &value) {
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        return *value;
+    } else {
+        return value;
+    }
+}
+
+// =================================================================================================
+// Internal type instance storage
+// =================================================================================================
+
+template <typename T, auto Sentinel>
+class ok_optional_storage {
+   protected:
+    using public_type [[maybe_unused]] = T;
+    using stored_type [[maybe_unused]] = stored_type_t<T>;
+
+    niche_optional_t<stored_type, Sentinel> m_ok;
+
+    ok_optional_storage() = default;
+
+    // Constructed in place: assigning to the empty optional lets GCC see T's assignment operator
+    // run on the sentinel and warn about it.
+    [[maybe_unused]] explicit ok_optional_storage(wrapper::Ok<T> ok)
+        : m_ok(std::move(ok.value)) {  // T* or T
+        assert(m_ok.has_value() && "Ok value equals the configured empty sentinel.");
+    }
+
+    [[maybe_unused]] [[nodiscard]] bool has_ok() const noexcept { return m_ok.has_value(); }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) ok_ref() & {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return **m_ok;  // T&
+        } else {
+            return (*m_ok);  // T&
+        }
+    }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) ok_ref() const & {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return **m_ok;  // T&
+        } else {
+            return (*m_ok);  // const T&
+        }
+    }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) ok_take() && {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return **m_ok;  // T&
+        } else {
+            return std::move(*m_ok);  // T
+        }
+    }
+};
+
+template <typename E, auto Sentinel>
+class err_optional_storage {
+   protected:
+    using public_type [[maybe_unused]] = E;
+    using stored_type [[maybe_unused]] = stored_type_t<E>;
+
+    niche_optional_t<stored_type, Sentinel> m_err;
+
+    err_optional_storage() = default;
+
+    [[maybe_unused]] explicit err_optional_storage(wrapper::Err<E> err)
+        : m_err(std::move(err.value)) {  // E* or E
+        assert(m_err.has_value() && "Err value equals the configured empty sentinel.");
+    }
+
+    [[maybe_unused]] [[nodiscard]] bool has_err() const noexcept { return m_err.has_value(); }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) err_ref() & {
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return **m_err;
+        } else {
+            return (*m_err);
+        }
+    }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) err_ref() const & {
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return **m_err;
+        } else {
+            return (*m_err);
+        }
+    }
+
+    [[maybe_unused]] [[nodiscard]] decltype(auto) err_take() && {
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return **m_err;
+        } else {
+            return std::move(*m_err);
+        }
+    }
+};
+
+// Storage of the general Result: a tagged union of both sides, in place of std::variant and its
+// header. Copy and move are trivial whenever they are for both sides, and deleted whenever either
+// side lacks them.
+struct uninitialized_union_tag {};
+
+template <typename Ok, typename Err,
+          bool = std::is_trivially_destructible_v<Ok> && std::is_trivially_destructible_v<Err>>
+struct union_result_data {
+    explicit union_result_data(uninitialized_union_tag) noexcept {}
+
+    // U is the public side type; its wrapper already holds the stored representation.
+    template <typename U>
+    explicit union_result_data(wrapper::Ok<U> &&ok) : ok(std::move(ok.value)), has_ok(true) {}
+
+    template <typename U>
+    explicit union_result_data(wrapper::Err<U> &&err) : err(std::move(err.value)), has_ok(false) {}
+
+    void destroy() noexcept {}
+
+    union {
+        Ok  ok;
+        Err err;
+    };
+
+    bool has_ok;
+};
+
+template <typename Ok, typename Err>
+struct union_result_data<Ok, Err, false> {
+    explicit union_result_data(uninitialized_union_tag) noexcept {}
+
+    template <typename U>
+    explicit union_result_data(wrapper::Ok<U> &&ok) : ok(std::move(ok.value)), has_ok(true) {}
+
+    template <typename U>
+    explicit union_result_data(wrapper::Err<U> &&err) : err(std::move(err.value)), has_ok(false) {}
+
+    union_result_data(const union_result_data &) = default;
+    union_result_data(union_result_data &&) = default;
+    union_result_data &operator=(const union_result_data &) = default;
+    union_result_data &operator=(union_result_data &&) = default;
+
+    ~union_result_data() { destroy(); }
+
+    void destroy() noexcept {
+        if (has_ok)
+            ok.~Ok();
+        else
+            err.~Err();
+    }
+
+    union {
+        Ok  ok;
+        Err err;
+    };
+
+    bool has_ok;
+};
+
+template <typename Ok, typename Err>
+inline constexpr bool trivial_union_copy_v =
+    std::is_trivially_copy_constructible_v<Ok> && std::is_trivially_copy_constructible_v<Err> &&
+    std::is_trivially_move_constructible_v<Ok> && std::is_trivially_move_constructible_v<Err> &&
+    std::is_trivially_copy_assignable_v<Ok> && std::is_trivially_copy_assignable_v<Err> &&
+    std::is_trivially_move_assignable_v<Ok> && std::is_trivially_move_assignable_v<Err> &&
+    std::is_trivially_destructible_v<Ok> && std::is_trivially_destructible_v<Err>;
+
+// Copy and move for sides that are not trivially copyable; trivially copyable ones use
+// trivial_union_result_storage instead.
+template <typename Ok, typename Err>
+struct union_result_ops : union_result_data<Ok, Err> {
+    using base = union_result_data<Ok, Err>;
+    using base::base;
+
+    union_result_ops(const union_result_ops &other) noexcept(
+        std::is_nothrow_copy_constructible_v<Ok> && std::is_nothrow_copy_constructible_v<Err>)
+        : base(uninitialized_union_tag{}) {
+        construct_from(other);
+    }
+
+    union_result_ops(union_result_ops &&other) noexcept(
+        std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Err>)
+        : base(uninitialized_union_tag{}) {
+        construct_from(std::move(other));
+    }
+
+    union_result_ops &operator=(const union_result_ops &other) noexcept(
+        std::is_nothrow_copy_constructible_v<Ok> && std::is_nothrow_copy_constructible_v<Err> &&
+        std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Err> &&
+        std::is_nothrow_copy_assignable_v<Ok> && std::is_nothrow_copy_assignable_v<Err>) {
+        assign_from(other);
+        return *this;
+    }
+
+    union_result_ops &operator=(union_result_ops &&other) noexcept(
+        std::is_nothrow_move_constructible_v<Ok> && std::is_nothrow_move_constructible_v<Err> &&
+        std::is_nothrow_move_assignable_v<Ok> && std::is_nothrow_move_assignable_v<Err>) {
+        assign_from(std::move(other));
+        return *this;
+    }
+
+    ~union_result_ops() = default;
+
+   private:
+    template <typename Other>
+    void construct_from(Other &&other) {
+        if (other.has_ok)
+            ::new (static_cast<void *>(detail::address_of(this->ok)))
+                Ok(std::forward<Other>(other).ok);
+        else
+            ::new (static_cast<void *>(detail::address_of(this->err)))
+                Err(std::forward<Other>(other).err);
+
+        this->has_ok = other.has_ok;
+    }
+
+    template <typename Other>
+    void assign_from(Other &&other) {
+        if (this == detail::address_of(other))
+            return;
+
+        if (this->has_ok == other.has_ok) {
+            if (other.has_ok)
+                this->ok = std::forward<Other>(other).ok;
+            else
+                this->err = std::forward<Other>(other).err;
+
+            return;
+        }
+
+        // Switching sides. The new side is built in a temporary first, so a throwing copy leaves
+        // *this untouched.
+        if (other.has_ok) {
+            Ok tmp(std::forward<Other>(other).ok);
+            switch_to<true>(tmp);
+        } else {
+            Err tmp(std::forward<Other>(other).err);
+            switch_to<false>(tmp);
+        }
+    }
+
+    // Replaces the current side with `side`. Selected by flag rather than by type, as Ok and Err
+    // may be the same type. A Result has no empty state, so if moving `side` in may throw, the
+    // current side is moved aside first and put back when it does; a side whose move throws on the
+    // way back leaves nothing valid to restore and terminates.
+    template <bool ToOk, typename Side>
+    void switch_to(Side &side) noexcept(std::is_nothrow_move_constructible_v<Side>) {
+        using Current = std::conditional_t<ToOk, Err, Ok>;
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+        if constexpr (!std::is_nothrow_move_constructible_v<Side>) {
+            Current backup(std::move(current<!ToOk>()));
+            this->destroy();
+
+            try {
+                emplace<ToOk>(std::move(side));
+            } catch (...) {
+                restore<!ToOk>(backup);
+                throw;
+            }
+
+            return;
+        }
+#endif
+
+        this->destroy();
+        emplace<ToOk>(std::move(side));
+    }
+
+    template <bool IsOk>
+    auto &current() noexcept {
+        if constexpr (IsOk)
+            return this->ok;
+        else
+            return this->err;
+    }
+
+    template <bool ToOk, typename Side>
+    void emplace(Side &&side) {
+        if constexpr (ToOk)
+            ::new (static_cast<void *>(detail::address_of(this->ok))) Ok(std::forward<Side>(side));
+        else
+            ::new (static_cast<void *>(detail::address_of(this->err)))
+                Err(std::forward<Side>(side));
+
+        this->has_ok = ToOk;
+    }
+
+    template <bool ToOk, typename Side>
+    void restore(Side &backup) noexcept {
+        emplace<ToOk>(std::move(backup));
+    }
+};
+
+// Empty bases that delete the special members the sides do not support; union_result_ops defines
+// them unconditionally.
+template <bool Copy, bool Move>
+struct enable_union_construct {};
+
+template <>
+struct enable_union_construct<false, true> {
+    enable_union_construct() = default;
+    enable_union_construct(const enable_union_construct &) = delete;
+    enable_union_construct(enable_union_construct &&) = default;
+    enable_union_construct &operator=(const enable_union_construct &) = default;
+    enable_union_construct &operator=(enable_union_construct &&) = default;
+};
+
+template <>
+struct enable_union_construct<false, false> {
+    enable_union_construct() = default;
+    enable_union_construct(const enable_union_construct &) = delete;
+    enable_union_construct(enable_union_construct &&) = delete;
+    enable_union_construct &operator=(const enable_union_construct &) = default;
+    enable_union_construct &operator=(enable_union_construct &&) = default;
+};
+
+template <>
+struct enable_union_construct<true, false> {
+    enable_union_construct() = default;
+    enable_union_construct(const enable_union_construct &) = default;
+    enable_union_construct(enable_union_construct &&) = delete;
+    enable_union_construct &operator=(const enable_union_construct &) = default;
+    enable_union_construct &operator=(enable_union_construct &&) = default;
+};
+
+template <bool Copy, bool Move>
+struct enable_union_assign {};
+
+template <>
+struct enable_union_assign<false, true> {
+    enable_union_assign() = default;
+    enable_union_assign(const enable_union_assign &) = default;
+    enable_union_assign(enable_union_assign &&) = default;
+    enable_union_assign &operator=(const enable_union_assign &) = delete;
+    enable_union_assign &operator=(enable_union_assign &&) = default;
+};
+
+template <>
+struct enable_union_assign<false, false> {
+    enable_union_assign() = default;
+    enable_union_assign(const enable_union_assign &) = default;
+    enable_union_assign(enable_union_assign &&) = default;
+    enable_union_assign &operator=(const enable_union_assign &) = delete;
+    enable_union_assign &operator=(enable_union_assign &&) = delete;
+};
+
+template <>
+struct enable_union_assign<true, false> {
+    enable_union_assign() = default;
+    enable_union_assign(const enable_union_assign &) = default;
+    enable_union_assign(enable_union_assign &&) = default;
+    enable_union_assign &operator=(const enable_union_assign &) = default;
+    enable_union_assign &operator=(enable_union_assign &&) = delete;
+};
+
+template <typename T, typename E>
+class union_result_storage
+    : private union_result_ops<stored_type_t<T>, stored_type_t<E>>,
+      private enable_union_construct<
+          std::is_copy_constructible_v<stored_type_t<T>> &&
+              std::is_copy_constructible_v<stored_type_t<E>>,
+          std::is_move_constructible_v<stored_type_t<T>> &&
+              std::is_move_constructible_v<stored_type_t<E>>>,
+      private enable_union_assign<
+          std::is_copy_constructible_v<stored_type_t<T>> &&
+              std::is_copy_constructible_v<stored_type_t<E>> &&
+              std::is_copy_assignable_v<stored_type_t<T>> &&
+              std::is_copy_assignable_v<stored_type_t<E>>,
+          std::is_move_constructible_v<stored_type_t<T>> &&
+              std::is_move_constructible_v<stored_type_t<E>> &&
+              std::is_move_assignable_v<stored_type_t<T>> &&
+              std::is_move_assignable_v<stored_type_t<E>>> {
+    using data = union_result_ops<stored_type_t<T>, stored_type_t<E>>;
+
+   public:
+    // Taken by reference: the payload moves once, from the wrapper into the union.
+    explicit union_result_storage(wrapper::Ok<T> &&ok) : data(std::move(ok)) {}
+
+    explicit union_result_storage(wrapper::Err<E> &&err) : data(std::move(err)) {}
+
+    [[nodiscard]] bool has_ok() const noexcept { return this->data::has_ok; }
+
+    stored_type_t<T> &ok_value() noexcept {
+        RESULT_ASSUME(this->data::has_ok);
+        return this->data::ok;
+    }
+
+    const stored_type_t<T> &ok_value() const noexcept {
+        RESULT_ASSUME(this->data::has_ok);
+        return this->data::ok;
+    }
+
+    stored_type_t<E> &err_value() noexcept {
+        RESULT_ASSUME(!this->data::has_ok);
+        return this->data::err;
+    }
+
+    const stored_type_t<E> &err_value() const noexcept {
+        RESULT_ASSUME(!this->data::has_ok);
+        return this->data::err;
+    }
+};
+
+// Flat storage for trivially copyable sides. Both layouts are returned in registers, but GCC
+// does not scalarize the layered union_result_ops/union_result_data bases and builds the object in
+// a stack slot first; a plain union and flag are assembled directly in the return register, as
+// for std::expected.
+template <typename T, typename E>
+class trivial_union_result_storage {
+   public:
+    explicit trivial_union_result_storage(wrapper::Ok<T> &&ok)
+        : m_ok(std::move(ok.value)), m_has_ok(true) {}
+
+    explicit trivial_union_result_storage(wrapper::Err<E> &&err)
+        : m_err(std::move(err.value)), m_has_ok(false) {}
+
+    [[nodiscard]] bool has_ok() const noexcept { return m_has_ok; }
+
+    stored_type_t<T> &ok_value() noexcept {
+        RESULT_ASSUME(m_has_ok);
+        return m_ok;
+    }
+
+    const stored_type_t<T> &ok_value() const noexcept {
+        RESULT_ASSUME(m_has_ok);
+        return m_ok;
+    }
+
+    stored_type_t<E> &err_value() noexcept {
+        RESULT_ASSUME(!m_has_ok);
+        return m_err;
+    }
+
+    const stored_type_t<E> &err_value() const noexcept {
+        RESULT_ASSUME(!m_has_ok);
+        return m_err;
+    }
+
+   private:
+    union {
+        stored_type_t<T> m_ok;
+        stored_type_t<E> m_err;
+    };
+
+    bool m_has_ok;
+};
+
+// Storage of the general Result when T has a niche and E is an empty class: the Err state is the
+// niche of T, and the (stateless) error lives in the empty base.
+template <typename T, typename E>
+inline constexpr bool use_niche_result_storage_v =
+    has_niche_v<stored_type_t<T>> && !std::is_reference_v<E> && std::is_empty_v<E> &&
+    !std::is_final_v<E> && std::is_trivially_default_constructible_v<E>;
+
+template <typename T, typename E>
+class niche_result_storage : private E {
+   public:
+    explicit niche_result_storage(wrapper::Ok<T> ok) : m_ok(std::move(ok.value)) {
+        assert(m_ok.has_value() && "Ok value equals the niche of its type.");
+    }
+
+    explicit niche_result_storage(wrapper::Err<E>) {}
+
+    [[nodiscard]] bool has_ok() const noexcept { return m_ok.has_value(); }
+
+    stored_type_t<T> &ok_value() noexcept {
+        RESULT_ASSUME(m_ok.has_value());
+        return *m_ok;
+    }
+
+    const stored_type_t<T> &ok_value() const noexcept {
+        RESULT_ASSUME(m_ok.has_value());
+        return *m_ok;
+    }
+
+    E &err_value() noexcept { return *this; }
+
+    const E &err_value() const noexcept { return *this; }
+
+   private:
+    niche_optional_t<stored_type_t<T>, tiny::UseDefaultValue> m_ok;
+};
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+inline constexpr bool pointer_low_half_first = true;
+#else
+inline constexpr bool pointer_low_half_first = false;
+#endif
+
+// Storage of the general Result when T is a pointer (or reference) and E an enum of at most 32
+// bits: the Err state is an invalid address whose upper half is the high_word of
+// SentinelRangeForExploitingUnusedBits and whose lower half holds the enum. is_ok() compares the
+// upper half only.
+template <typename T, typename E, typename = void>
+struct use_pointer_enum_result_storage : std::false_type {};
+
+template <typename T, typename E>
+struct use_pointer_enum_result_storage<T, E, std::enable_if_t<std::is_enum_v<E>>>
+    : std::bool_constant<
+          tiny::impl::SentinelRangeForExploitingUnusedBitsIsKnown<stored_type_t<T>> &&
+          sizeof(E) <= sizeof(std::uint32_t) && pointer_low_half_first> {};
+
+template <typename T, typename E>
+inline constexpr bool use_pointer_enum_result_storage_v =
+    use_pointer_enum_result_storage<T, E>::value;
+
+template <typename T, typename E>
+class pointer_enum_result_storage {
+    using pointer = stored_type_t<T>;
+    using range = tiny::impl::SentinelRangeForExploitingUnusedBits<pointer>;
+
+    // The Err side spans the whole pointer word, so the upper half is a member of the active
+    // union member rather than padding that a copy may leave behind.
+    struct err_word {
+        E             value;
+        std::uint32_t high;
+    };
+
+    static constexpr std::size_t high_offset = sizeof(pointer) - sizeof(range::high_word);
+
+    static_assert(sizeof(err_word) == sizeof(pointer) && alignof(err_word) <= alignof(pointer));
+    static_assert(offsetof(err_word, high) == high_offset);
+
+   public:
+    explicit pointer_enum_result_storage(wrapper::Ok<T> ok) noexcept : m_ok(ok.value) {
+        assert(has_ok() && "Ok pointer lies in the range reserved for errors.");
+    }
+
+    explicit pointer_enum_result_storage(wrapper::Err<E> err) noexcept
+        : m_err{err.value, range::high_word} {}
+
+    // Reads the upper half through the object representation, which works whichever side is
+    // active.
+    [[nodiscard]] bool has_ok() const noexcept {
+        const auto   *bytes = reinterpret_cast<const unsigned char *>(this);
+        std::uint32_t high;
+        std::memcpy(&high, bytes + high_offset, sizeof(high));
+        return high != range::high_word;
+    }
+
+    pointer &ok_value() noexcept {
+        RESULT_ASSUME(has_ok());
+        return m_ok;
+    }
+
+    const pointer &ok_value() const noexcept {
+        RESULT_ASSUME(has_ok());
+        return m_ok;
+    }
+
+    E &err_value() noexcept {
+        RESULT_ASSUME(!has_ok());
+        return m_err.value;
+    }
+
+    const E &err_value() const noexcept {
+        RESULT_ASSUME(!has_ok());
+        return m_err.value;
+    }
+
+   private:
+    union {
+        pointer  m_ok;
+        err_word m_err;
+    };
+};
+
+template <typename T, typename E>
+using result_storage_t = std::conditional_t<
+    use_niche_result_storage_v<T, E>, niche_result_storage<T, E>,
+    std::conditional_t<use_pointer_enum_result_storage_v<T, E>, pointer_enum_result_storage<T, E>,
+                       std::conditional_t<trivial_union_copy_v<stored_type_t<T>, stored_type_t<E>>,
+                                          trivial_union_result_storage<T, E>,
+                                          union_result_storage<T, E>>>>;
+
+template <typename T>
+[[maybe_unused]] inline constexpr bool is_result_ref_v = std::is_lvalue_reference_v<T>;
+
+template <typename T>
+using result_ref_base_t [[maybe_unused]] = std::remove_reference_t<T>;
+
+// =================================================================================================
+// Sentinel type values
+// =================================================================================================
+
+template <auto V>
+[[maybe_unused]] inline constexpr bool is_default_sentinel_v =
+    std::is_same_v<std::decay_t<decltype(V)>, tiny::UseDefaultType> && V == tiny::UseDefaultValue;
+
+template <typename T, auto Sentinel>
+[[maybe_unused]] inline constexpr bool sentinel_type_compatible_v =
+    is_default_sentinel_v<Sentinel> || std::is_convertible_v<decltype(Sentinel), T>;
+
+template <typename T, auto Sentinel>
+[[maybe_unused]] inline constexpr bool sentinel_not_void_v =
+    !std::is_void_v<T> || is_default_sentinel_v<Sentinel>;
+
+// =================================================================================================
+// Exception
+// =================================================================================================
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+class bad_result_access : public std::exception {
+   public:
+    const char *what() const noexcept override { return "Bad Result access!"; }
+};
+#endif
+
+}  // namespace detail
+
+// =================================================================================================
+// Result<T, E> where T and E are void - degenerate bool storage case
+// =================================================================================================
+
+template <>
+class [[nodiscard]] Result<void, void> {
+   public:
+    using ok_type [[maybe_unused]] = void;
+    using err_type [[maybe_unused]] = void;
+
+   private:
+    bool m_ok;
+
+   public:
+    Result(wrapper::Ok<void>) noexcept : m_ok{true} {}
+    Result(wrapper::Err<void>) noexcept : m_ok{false} { RESULT_USDT_PROBE0(result, err); }
+    Result(const Result &) = default;
+    Result(Result &&) noexcept = default;
+
+    Result &operator=(const Result &) = default;
+    Result &operator=(Result &&) noexcept = default;
+
+    ~Result() = default;
+
+    // =============================================================================================
+    // member functions
+    // =============================================================================================
+
+    [[nodiscard]] bool is_ok() const noexcept { return m_ok; }
+
+    [[nodiscard]] bool is_err() const noexcept { return !m_ok; }
+
+    [[maybe_unused]] void unwrap(RESULT_SITE_PARAM) const {
+        RESULT_COUNT_UNWRAP(is_ok());
+
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap a result containing an error");
+    }
+
+    [[maybe_unused]] void unwrap_err() const {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap an error containing a result");
+    }
+
+    [[maybe_unused]] void unwrap_unchecked() const {}
+
+    [[maybe_unused]] void unwrap_err_unchecked() const {}
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    [[maybe_unused]] decltype(auto) unwrap_or_throw() && {
+        if (is_ok())
+            return std::move(*this).unwrap_unchecked();
+
+        RESULT_USDT_PROBE0(result, throw);
+        throw detail::bad_result_access{};
+    }
+#endif
+
+    [[maybe_unused]] void expect(const char *message) const {
+        if (!is_ok())
+            detail::expect_failed(message);
+    }
+
+    [[maybe_unused]] void expect(std::string_view message) const {
+        if (!is_ok())
+            detail::expect_failed(message);
+    }
+
+    // Builds the message only on failure, e.g. to format details into a std::string.
+    template <typename Fn, typename = std::enable_if_t<std::is_invocable_v<Fn &>>>
+    [[maybe_unused]] void expect_with(Fn &&make_message) const {
+        if (!is_ok())
+            detail::expect_failed(detail::invoke(make_message));
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto map(Fn &&fn) && {
+        using Ret = std::invoke_result_t<Fn>;
+
+        if (is_ok()) {
+            if constexpr (std::is_void_v<Ret>) {
+                detail::invoke(std::forward<Fn>(fn));
+                return Result<void, void>(Ok());
+            } else {
+                return Result<Ret, void>(Ok(detail::invoke(std::forward<Fn>(fn))));
+            }
+        }
+
+        if constexpr (std::is_void_v<Ret>) {
+            return Result<void, void>(Err());
+        } else {
+            return Result<Ret, void>(Err());
+        }
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto map_err(ErrFn &&fn) && {
+        using ErrRet = std::invoke_result_t<ErrFn>;
+
+        if (is_err()) {
+            if constexpr (std::is_void_v<ErrRet>) {
+                detail::invoke(std::forward<ErrFn>(fn));
+                return Result<void, void>(Err());
+            } else {
+                return Result<void, ErrRet>(Err(detail::invoke(std::forward<ErrFn>(fn))));
+            }
+        }
+
+        if constexpr (std::is_void_v<ErrRet>) {
+            return Result<void, void>(Ok());
+        } else {
+            return Result<void, ErrRet>(Ok());
+        }
+    }
+
+    template <typename Fn, typename Ret>
+    [[maybe_unused]] Ret map_or(Fn &&fn, Ret fallback) && {
+        return is_ok() ? detail::invoke(std::forward<Fn>(fn)) : std::move(fallback);
+    }
+
+    template <typename Fn, typename FnOther>
+    [[maybe_unused]] auto map_or_else(Fn &&fn, FnOther &&other) && {
+        return is_ok() ? detail::invoke(std::forward<Fn>(fn))
+                       : detail::invoke(std::forward<FnOther>(other));
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto and_then(Fn &&fn) && {
+        using Ret = std::invoke_result_t<Fn>;
+        static_assert(detail::is_result<Ret>::value,
+                      "and_then callback must return Result<U, void>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<Ret>::err_type, void>,
+                      "and_then callback must preserve the error type void.");
+
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn));
+
+        return Ret(Err());
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto or_else(ErrFn &&fn) && {
+        using ErrRet = std::invoke_result_t<ErrFn>;
+        static_assert(detail::is_result<ErrRet>::value,
+                      "or_else callback must return Result<void, U>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<ErrRet>::ok_type, void>,
+                      "or_else callback must preserve the ok type void.");
+
+        if (is_err())
+            return detail::invoke(std::forward<ErrFn>(fn));
+
+        return ErrRet(Ok());
+    }
+
+    bool operator==(const wrapper::Ok<void> &) const { return is_ok(); }
+
+    bool operator!=(const wrapper::Ok<void> &ok) const { return !(*this == ok); }
+
+    bool operator==(const wrapper::Err<void> &) const { return is_err(); }
+
+    bool operator!=(const wrapper::Err<void> &err) const { return !(*this == err); }
+
+    bool operator==(const Result<void, void> &other) const { return m_ok == other.m_ok; }
+
+    bool operator!=(const Result<void, void> &other) const { return !(*this == other); }
+
+#ifdef RESULT_THREE_WAY_COMPARISON
+    std::strong_ordering operator<=>(const Result &other) const noexcept {
+        return other.m_ok <=> m_ok;
+    }
+#endif
+};
+
+// =================================================================================================
+// Result<T, E> where E is void - enabling niche optimization
+// =================================================================================================
+
+template <typename T, auto OkSentinel, auto ErrSentinel>
+class [[nodiscard]] Result<T, void, OkSentinel, ErrSentinel>
+    : private detail::ok_optional_storage<T, OkSentinel> {
+    static_assert(!std::is_void_v<T>, "Use Result<void, void>.");
+    static_assert(!std::is_rvalue_reference_v<T>, "Result<T&&, void> is not supported.");
+
+    static_assert(detail::is_default_sentinel_v<ErrSentinel>,
+                  "ErrSentinel is meaningless for E == void.");
+
+    using storage = detail::ok_optional_storage<T, OkSentinel>;
+
+    template <typename, bool>
+    friend struct detail::result_hash;
+
+   public:
+    using ok_type [[maybe_unused]] = T;
+    using err_type [[maybe_unused]] = void;
+
+    Result(wrapper::Ok<T> ok) : storage(std::move(ok)) {}
+    Result(wrapper::Err<void>) : storage() { RESULT_USDT_PROBE0(result, err); }
+    Result(const Result &) = default;
+    Result(Result &&) noexcept = default;
+
+    Result &operator=(const Result &) = default;
+    Result &operator=(Result &&) noexcept = default;
+
+    ~Result() = default;
+
+    // =============================================================================================
+    // member functions
+    // =============================================================================================
+
+    [[nodiscard]] bool is_ok() const noexcept { return storage::has_ok(); }
+
+    [[nodiscard]] bool is_err() const noexcept { return !storage::has_ok(); }
+
+    [[maybe_unused]] decltype(auto) unwrap_ref() & {
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap_ref a result containing an error");
+
+        return storage::ok_ref();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_ref() const & {
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap_ref a result containing an error");
+
+        return storage::ok_ref();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap(RESULT_SITE_PARAM) && {
+        RESULT_COUNT_UNWRAP(is_ok());
+
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap a result containing an error");
+
+        return std::move(*this).storage::ok_take();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_unchecked() && {
+        return std::move(*this).storage::ok_take();
+    }
+
+    [[maybe_unused]] void unwrap_err() const {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap an error containing a result");
+    }
+
+    [[maybe_unused]] void unwrap_err_unchecked() const {}
+
+    template <typename U = T, typename = std::enable_if_t<!std::is_lvalue_reference_v<U> &&
+                                                          std::is_default_constructible_v<U>>>
+    [[maybe_unused]] T unwrap_or_default() && {
+        if (is_ok())
+            return std::move(*this).storage::ok_take();
+
+        return T{};
+    }
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    [[maybe_unused]] decltype(auto) unwrap_or_throw() && {
+        if (is_ok())
+            return std::move(*this).unwrap_unchecked();
+
+        RESULT_USDT_PROBE0(result, throw);
+        throw detail::bad_result_access{};
+    }
+#endif
+
+    [[maybe_unused]] decltype(auto) expect(const char *message) && {
+        if (!is_ok())
+            detail::expect_failed(message);
+
+        return std::move(*this).storage::ok_take();
+    }
+
+    [[maybe_unused]] decltype(auto) expect(std::string_view message) && {
+        if (!is_ok())
+            detail::expect_failed(message);
+
+        return std::move(*this).storage::ok_take();
+    }
+
+    // Builds the message only on failure, e.g. to format details into a std::string.
+    template <typename Fn, typename = std::enable_if_t<std::is_invocable_v<Fn &>>>
+    [[maybe_unused]] decltype(auto) expect_with(Fn &&make_message) && {
+        if (!is_ok())
+            detail::expect_failed(detail::invoke(make_message));
+
+        return std::move(*this).storage::ok_take();
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto map(Fn &&fn) && {
+        using Arg = decltype(std::move(*this).storage::ok_take());
+        using Ret = std::invoke_result_t<Fn, Arg>;
+
+        if (is_ok()) {
+            if constexpr (std::is_void_v<Ret>) {
+                detail::invoke(std::forward<Fn>(fn), std::move(*this).storage::ok_take());
+                return Result<void, void>(Ok());
+            } else {
+                return Result<Ret, void>(
+                    Ok(detail::invoke(std::forward<Fn>(fn), std::move(*this).storage::ok_take())));
+            }
+        }
+
+        if constexpr (std::is_void_v<Ret>) {
+            return Result<void, void>(Err());
+        } else {
+            return Result<Ret, void>(Err());
+        }
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto map_err(ErrFn &&fn) && {
+        using ErrRet = std::invoke_result_t<ErrFn>;
+
+        if (is_err()) {
+            if constexpr (std::is_void_v<ErrRet>) {
+                detail::invoke(std::forward<ErrFn>(fn));
+                return Result<T, void, OkSentinel, ErrSentinel>(Err());
+            } else {
+                return Result<T, ErrRet>(Err(detail::invoke(std::forward<ErrFn>(fn))));
+            }
+        }
+
+        if constexpr (std::is_void_v<ErrRet>) {
+            return Result<T, void, OkSentinel, ErrSentinel>(
+                Ok(std::move(*this).storage::ok_take()));
+        } else {
+            return Result<T, ErrRet>(Ok(std::move(*this).storage::ok_take()));
+        }
+    }
+
+    template <typename Fn, typename Ret>
+    [[maybe_unused]] auto map_or(Fn &&fn, Ret fallback) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), std::move(*this).storage::ok_take());
+
+        return std::move(fallback);
+    }
+
+    template <typename Fn, typename FnOther>
+    [[maybe_unused]] auto map_or_else(Fn &&fn, FnOther &&other) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), std::move(*this).storage::ok_take());
+
+        return detail::invoke(std::forward<FnOther>(other));
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto and_then(Fn &&fn) && {
+        using Arg = decltype(std::move(*this).storage::ok_take());
+        using Ret = std::invoke_result_t<Fn, Arg>;
+
+        static_assert(detail::is_result<Ret>::value,
+                      "and_then callback must return Result<U, void>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<Ret>::err_type, void>,
+                      "and_then callback must preserve the error type void.");
+
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), std::move(*this).storage::ok_take());
+
+        return Ret(Err());
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto or_else(ErrFn &&fn) && {
+        using ErrRet = std::invoke_result_t<ErrFn>;
+
+        static_assert(detail::is_result<ErrRet>::value,
+                      "or_else callback must return Result<T, U>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<ErrRet>::ok_type, T>,
+                      "or_else callback must preserve the ok type T.");
+
+        if (is_err())
+            return detail::invoke(std::forward<ErrFn>(fn));
+
+        return ErrRet(Ok(std::move(*this).storage::ok_take()));
+    }
+
+    bool operator==(const wrapper::Ok<T> &ok) const {
+        if (!is_ok())
+            return false;
+
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return storage::ok_ref() == *ok.value;
+        } else {
+            return storage::ok_ref() == ok.value;
+        }
+    }
+
+    bool operator!=(const wrapper::Ok<T> &ok) const {
+        return !(*this == ok);  // keep as is
+    }
+
+    bool operator==(const wrapper::Err<void> &) const { return is_err(); }
+
+    bool operator!=(const wrapper::Err<void> &err) const {
+        return !(*this == err);  // keep as is
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator==(const Result<U, G, OS, ES> &other) const {
+        if (is_ok() != other.is_ok())
+            return false;
+
+        if (is_ok())
+            return unwrap_ref() == other.unwrap_ref();
+
+        if constexpr (std::is_void_v<G>) {
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator!=(const Result<U, G, OS, ES> &other) const {
+        return !(*this == other);  // keep as is
+    }
+
+#ifdef RESULT_THREE_WAY_COMPARISON
+    auto operator<=>(const Result &other) const
+        requires std::three_way_comparable<detail::side_value_t<T>>
+    {
+        using ordering = detail::side_ordering_t<T>;
+
+        if (is_ok() != other.is_ok())
+            return detail::order_by_state<ordering>(is_ok());
+
+        if (!is_ok())
+            return ordering(std::strong_ordering::equal);
+
+        return ordering(unwrap_ref() <=> other.unwrap_ref());
+    }
+#endif
+};
+
+// =================================================================================================
+// Result<T, E> where T is void - enabling niche optimization
+// =================================================================================================
+
+template <typename E, auto OkSentinel, auto ErrSentinel>
+class [[nodiscard]] Result<void, E, OkSentinel, ErrSentinel>
+    : private detail::err_optional_storage<E, ErrSentinel> {
+    static_assert(!std::is_void_v<E>, "Use Result<void, void>.");
+    static_assert(!std::is_rvalue_reference_v<E>, "Result<void, E&&> is not supported.");
+    static_assert(detail::is_default_sentinel_v<OkSentinel>,
+                  "OkSentinel is meaningless for T == void.");
+
+    using storage = detail::err_optional_storage<E, ErrSentinel>;
+
+    template <typename, bool>
+    friend struct detail::result_hash;
+
+   public:
+    using ok_type [[maybe_unused]] = void;
+    using err_type [[maybe_unused]] = E;
+
+    Result(wrapper::Ok<void>) : storage() {}
+    Result(wrapper::Err<E> err) : storage(std::move(err)) { RESULT_USDT_PROBE0(result, err); }
+    Result(const Result &) = default;
+    Result(Result &&) noexcept = default;
+
+    Result &operator=(const Result &) = default;
+    Result &operator=(Result &&) noexcept = default;
+
+    ~Result() = default;
+
+    // =============================================================================================
+    // member functions
+    // =============================================================================================
+
+    [[nodiscard]] bool is_ok() const noexcept { return !storage::has_err(); }
+
+    [[nodiscard]] bool is_err() const noexcept { return storage::has_err(); }
+
+    [[maybe_unused]] void unwrap(RESULT_SITE_PARAM) const {
+        RESULT_COUNT_UNWRAP(is_ok());
+
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap a result containing an error");
+    }
+
+    [[maybe_unused]] void unwrap_unchecked() const {}
+
+    [[maybe_unused]] decltype(auto) unwrap_err_ref() & {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap_err_ref an error containing a result");
+
+        return storage::err_ref();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err_ref() const & {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap_err_ref an error containing a result");
+
+        return storage::err_ref();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err() && {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap_err an ok result");
+
+        return std::move(*this).storage::err_take();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err_unchecked() && {
+        return std::move(*this).storage::err_take();
+    }
+
+    [[maybe_unused]] void expect(const char *message) const {
+        if (!is_ok())
+            detail::expect_failed(message);
+    }
+
+    [[maybe_unused]] void expect(std::string_view message) const {
+        if (!is_ok())
+            detail::expect_failed(message);
+    }
+
+    // Builds the message only on failure, e.g. to format details into a std::string.
+    template <typename Fn, typename = std::enable_if_t<std::is_invocable_v<Fn &>>>
+    [[maybe_unused]] void expect_with(Fn &&make_message) const {
+        if (!is_ok())
+            detail::expect_failed(detail::invoke(make_message));
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto map(Fn &&fn) && {
+        using Ret = std::invoke_result_t<Fn>;
+
+        if (is_ok()) {
+            if constexpr (std::is_void_v<Ret>) {
+                detail::invoke(std::forward<Fn>(fn));
+                return Result<void, E, OkSentinel, ErrSentinel>(Ok());
+            } else {
+                return Result<Ret, E>(Ok(detail::invoke(std::forward<Fn>(fn))));
+            }
+        }
+
+        if constexpr (std::is_void_v<Ret>) {
+            return Result<void, E, OkSentinel, ErrSentinel>(
+                Err(std::move(*this).unwrap_err_unchecked()));
+        } else {
+            return Result<Ret, E>(Err(std::move(*this).unwrap_err_unchecked()));
+        }
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto map_err(ErrFn &&fn) && {
+        using ErrArg = decltype(std::move(*this).storage::err_take());
+        using ErrRet = std::invoke_result_t<ErrFn, ErrArg>;
+
+        if (is_err()) {
+            if constexpr (std::is_void_v<ErrRet>) {
+                detail::invoke(std::forward<ErrFn>(fn), std::move(*this).storage::err_take());
+                return Result<void, void>(Err());
+            } else {
+                return Result<void, ErrRet>(Err(
+                    detail::invoke(std::forward<ErrFn>(fn), std::move(*this).storage::err_take())));
+            }
+        }
+
+        if constexpr (std::is_void_v<ErrRet>) {
+            return Result<void, void>(Ok());
+        } else {
+            return Result<void, ErrRet>(Ok());
+        }
+    }
+
+    template <typename Fn, typename Ret>
+    [[maybe_unused]] auto map_or(Fn &&fn, Ret fallback) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn));
+
+        return std::move(fallback);
+    }
+
+    template <typename Fn, typename FnOther>
+    [[maybe_unused]] auto map_or_else(Fn &&fn, FnOther &&other) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn));
+
+        return detail::invoke(std::forward<FnOther>(other), std::move(*this).storage::err_take());
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto and_then(Fn &&fn) && {
+        using Ret = std::invoke_result_t<Fn>;
+
+        static_assert(detail::is_result<Ret>::value, "and_then callback must return Result<U, E>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<Ret>::err_type, E>,
+                      "and_then callback must preserve the error type E.");
+
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn));
+
+        return Ret(Err(std::move(*this).storage::err_take()));
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto or_else(ErrFn &&fn) && {
+        using ErrArg = decltype(std::move(*this).storage::err_take());
+        using ErrRet = std::invoke_result_t<ErrFn, ErrArg>;
+
+        static_assert(detail::is_result<ErrRet>::value,
+                      "or_else callback must return Result<void, U>.");
+        static_assert(std::is_same_v<typename detail::destruct_result<ErrRet>::ok_type, void>,
+                      "or_else callback must preserve the ok type void.");
+
+        if (is_err())
+            return detail::invoke(std::forward<ErrFn>(fn), std::move(*this).storage::err_take());
+
+        return ErrRet(Ok());
+    }
+
+    bool operator==(const wrapper::Ok<void> &) const { return is_ok(); }
+
+    bool operator!=(const wrapper::Ok<void> &ok) const {
+        return !(*this == ok);  // keep as is
+    }
+
+    bool operator==(const wrapper::Err<E> &err) const {
+        if (!is_err())
+            return false;
+
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return storage::err_ref() == *err.value;
+        } else {
+            return storage::err_ref() == err.value;
+        }
+    }
+
+    bool operator!=(const wrapper::Err<E> &err) const {
+        return !(*this == err);  // keep as is
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator==(const Result<U, G, OS, ES> &other) const {
+        if (is_ok() != other.is_ok())
+            return false;
+
+        if (is_ok()) {
+            if constexpr (std::is_void_v<U>) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        return unwrap_err_ref() == other.unwrap_err_ref();
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator!=(const Result<U, G, OS, ES> &other) const {
+        return !(*this == other);  // keep as is
+    }
+
+#ifdef RESULT_THREE_WAY_COMPARISON
+    auto operator<=>(const Result &other) const
+        requires std::three_way_comparable<detail::side_value_t<E>>
+    {
+        using ordering = detail::side_ordering_t<E>;
+
+        if (is_ok() != other.is_ok())
+            return detail::order_by_state<ordering>(is_ok());
+
+        if (is_ok())
+            return ordering(std::strong_ordering::equal);
+
+        return ordering(unwrap_err_ref() <=> other.unwrap_err_ref());
+    }
+#endif
+};
+
+// =================================================================================================
+// Result<T, E> where neither T nor E are void
+// =================================================================================================
+
+template <typename T, typename E, auto OkSentinel, auto ErrSentinel>
+class [[nodiscard]] Result {
+    static_assert(!std::is_void_v<T>, "Use the Result<void, E> specialization.");
+    static_assert(!std::is_void_v<E>, "Use the Result<T, void> specialization.");
+    static_assert(!std::is_rvalue_reference_v<T>, "Result<T&&, E> is not supported.");
+    static_assert(!std::is_rvalue_reference_v<E>, "Result<T, E&&> is not supported.");
+
+    detail::result_storage_t<T, E> m_storage;
+
+    [[maybe_unused]] T ok_take() {
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return *m_storage.ok_value();
+        } else {
+            return std::move(m_storage.ok_value());
+        }
+    }
+
+    [[maybe_unused]] E err_take() {
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return *m_storage.err_value();
+        } else {
+            return std::move(m_storage.err_value());
+        }
+    }
+
+   public:
+    using ok_type [[maybe_unused]] = T;
+    using err_type [[maybe_unused]] = E;
+
+    Result(wrapper::Ok<T> ok) : m_storage(std::move(ok)) {}
+
+    Result(wrapper::Err<E> err) : m_storage(std::move(err)) { RESULT_USDT_PROBE0(result, err); }
+
+    Result(const Result &) = default;
+
+    Result(Result &&) noexcept(std::is_nothrow_move_constructible_v<decltype(m_storage)>) = default;
+
+    Result &operator=(const Result &) = default;
+
+    Result &operator=(Result &&) noexcept(std::is_nothrow_move_assignable_v<decltype(m_storage)>) =
+        default;
+
+    ~Result() = default;
+
+    // =============================================================================================
+    // member functions
+    // =============================================================================================
+
+    [[nodiscard]] bool is_ok() const noexcept { return m_storage.has_ok(); }
+
+    [[nodiscard]] bool is_err() const noexcept { return !m_storage.has_ok(); }
+
+    [[maybe_unused]] decltype(auto) unwrap_ref() & {
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap_ref a result containing an error");
+
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return *m_storage.ok_value();
+        } else {
+            return (m_storage.ok_value());
+        }
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_ref() const & {
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap_ref a result containing an error");
+
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return *m_storage.ok_value();
+        } else {
+            return static_cast<const T &>(m_storage.ok_value());
+        }
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err_ref() & {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap_err_ref an error containing a result");
+
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return *m_storage.err_value();
+        } else {
+            return (m_storage.err_value());
+        }
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err_ref() const & {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap_err_ref an error containing a result");
+
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return *m_storage.err_value();
+        } else {
+            return static_cast<const E &>(m_storage.err_value());
+        }
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap(RESULT_SITE_PARAM) && {
+        RESULT_COUNT_UNWRAP(is_ok());
+
+        if (!is_ok())
+            RESULT_ERROR("Tried to unwrap a result containing an error");
+
+        return ok_take();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_err() && {
+        if (!is_err())
+            RESULT_ERROR("Tried to unwrap an error containing a result");
+
+        return err_take();
+    }
+
+    [[maybe_unused]] decltype(auto) unwrap_unchecked() && { return ok_take(); }
+
+    [[maybe_unused]] decltype(auto) unwrap_err_unchecked() && { return err_take(); }
+
+    [[maybe_unused]] T unwrap_or(T fallback) && {
+        if (is_ok())
+            return ok_take();
+
+        return fallback;
+    }
+
+    template <typename U = T, typename = std::enable_if_t<!std::is_lvalue_reference_v<U> &&
+                                                          std::is_default_constructible_v<U>>>
+    [[maybe_unused]] T unwrap_or_default() && {
+        if (is_ok())
+            return ok_take();
+
+        return T{};
+    }
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    [[maybe_unused]] decltype(auto) unwrap_or_throw() && {
+        if (is_ok())
+            return std::move(*this).unwrap_unchecked();
+
+        static_assert(
+            !std::is_lvalue_reference_v<E>,
+            "unwrap_or_throw() is disabled for Result<T, E&> to avoid accidental slicing.");
+
+        static_assert(std::is_base_of_v<std::exception, std::remove_reference_t<E>>,
+                      "unwrap_or_throw() requires E to derive from std::exception.");
+
+        RESULT_USDT_PROBE0(result, throw);
+        throw std::move(*this).unwrap_err_unchecked();
+    }
+#endif
+
+    [[maybe_unused]] decltype(auto) expect(const char *message) && {
+        if (!is_ok())
+            detail::expect_failed(message);
+
+        return ok_take();
+    }
+
+    [[maybe_unused]] decltype(auto) expect(std::string_view message) && {
+        if (!is_ok())
+            detail::expect_failed(message);
+
+        return ok_take();
+    }
+
+    // Builds the message only on failure, e.g. to format details into a std::string.
+    template <typename Fn, typename = std::enable_if_t<std::is_invocable_v<Fn &>>>
+    [[maybe_unused]] decltype(auto) expect_with(Fn &&make_message) && {
+        if (!is_ok())
+            detail::expect_failed(detail::invoke(make_message));
+
+        return ok_take();
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto map(Fn &&fn) && {
+        using Arg = decltype(std::declval<Result &>().ok_take());
+        using Ret = std::invoke_result_t<Fn, Arg>;
+
+        if (is_ok()) {
+            if constexpr (std::is_void_v<Ret>) {
+                detail::invoke(std::forward<Fn>(fn), ok_take());
+                return Result<void, E>(Ok());
+            } else {
+                return Result<Ret, E>(Ok(detail::invoke(std::forward<Fn>(fn), ok_take())));
+            }
+        }
+
+        if constexpr (std::is_void_v<Ret>) {
+            return Result<void, E>(Err(err_take()));
+        } else {
+            return Result<Ret, E>(Err(err_take()));
+        }
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto map_err(ErrFn &&fn) && {
+        using ErrArg = decltype(std::declval<Result &>().err_take());
+        using ErrRet = std::invoke_result_t<ErrFn, ErrArg>;
+
+        if (is_err()) {
+            if constexpr (std::is_void_v<ErrRet>) {
+                detail::invoke(std::forward<ErrFn>(fn), err_take());
+                return Result<T, void>(Err());
+            } else {
+                return Result<T, ErrRet>(Err(detail::invoke(std::forward<ErrFn>(fn), err_take())));
+            }
+        }
+
+        if constexpr (std::is_void_v<ErrRet>) {
+            return Result<T, void>(Ok(ok_take()));
+        } else {
+            return Result<T, ErrRet>(Ok(ok_take()));
+        }
+    }
+
+    template <typename Fn, typename Ret>
+    [[maybe_unused]] auto map_or(Fn &&fn, Ret fallback) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), ok_take());
+
+        return std::move(fallback);
+    }
+
+    template <typename Fn, typename FnOther>
+    [[maybe_unused]] auto map_or_else(Fn &&fn, FnOther &&other) && {
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), ok_take());
+
+        return detail::invoke(std::forward<FnOther>(other), err_take());
+    }
+
+    template <typename Fn>
+    [[maybe_unused]] auto and_then(Fn &&fn) && {
+        using Arg = decltype(std::declval<Result &>().ok_take());
+        using Ret = std::invoke_result_t<Fn, Arg>;
+
+        static_assert(detail::is_result<Ret>::value, "and_then callback must return Result<U, E>.");
+
+        static_assert(std::is_same_v<typename detail::destruct_result<Ret>::err_type, E>,
+                      "and_then callback must preserve the error type E.");
+
+        if (is_ok())
+            return detail::invoke(std::forward<Fn>(fn), ok_take());
+
+        return Ret(Err(err_take()));
+    }
+
+    template <typename ErrFn>
+    [[maybe_unused]] auto or_else(ErrFn &&fn) && {
+        using ErrArg = decltype(std::declval<Result &>().err_take());
+        using ErrRet = std::invoke_result_t<ErrFn, ErrArg>;
+
+        static_assert(detail::is_result<ErrRet>::value,
+                      "or_else callback must return Result<T, U>.");
+
+        static_assert(std::is_same_v<typename detail::destruct_result<ErrRet>::ok_type, T>,
+                      "or_else callback must preserve the ok type T.");
+
+        if (is_err())
+            return detail::invoke(std::forward<ErrFn>(fn), err_take());
+
+        return ErrRet(Ok(ok_take()));
+    }
+
+    bool operator==(const wrapper::Ok<T> &ok) const {
+        if (!is_ok())
+            return false;
+
+        if constexpr (std::is_lvalue_reference_v<T>) {
+            return unwrap_ref() == *ok.value;
+        } else {
+            return unwrap_ref() == ok.value;
+        }
+    }
+
+    bool operator!=(const wrapper::Ok<T> &ok) const {
+        return !(*this == ok);  // keep as is
+    }
+
+    bool operator==(const wrapper::Err<E> &err) const {
+        if (!is_err())
+            return false;
+
+        if constexpr (std::is_lvalue_reference_v<E>) {
+            return unwrap_err_ref() == *err.value;
+        } else {
+            return unwrap_err_ref() == err.value;
+        }
+    }
+
+    bool operator!=(const wrapper::Err<E> &err) const {
+        return !(*this == err);  // keep as is
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator==(const Result<U, G, OS, ES> &other) const {
+        if (is_ok() != other.is_ok())
+            return false;
+
+        if (is_ok())
+            return unwrap_ref() == other.unwrap_ref();
+
+        return unwrap_err_ref() == other.unwrap_err_ref();
+    }
+
+    template <typename U, typename G, auto OS, auto ES>
+    bool operator!=(const Result<U, G, OS, ES> &other) const {
+        return !(*this == other);  // keep as is
+    }
+
+#ifdef RESULT_THREE_WAY_COMPARISON
+    auto operator<=>(const Result &other) const
+        requires std::three_way_comparable<detail::side_value_t<T>> &&
+                 std::three_way_comparable<detail::side_value_t<E>>
+    {
+        using ordering = std::common_comparison_category_t<detail::side_ordering_t<T>,
+                                                           detail::side_ordering_t<E>>;
+
+        if (is_ok() != other.is_ok())
+            return detail::order_by_state<ordering>(is_ok());
+
+        if (is_ok())
+            return ordering(unwrap_ref() <=> other.unwrap_ref());
+
+        return ordering(unwrap_err_ref() <=> other.unwrap_err_ref());
+    }
+#endif
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+// =================================================================================================
+// std::hash
+// =================================================================================================
+
+namespace std {
+
+template <typename T, typename E, auto OkSentinel, auto ErrSentinel>
+struct hash<RESULT_NS::Result<T, E, OkSentinel, ErrSentinel>>
+    : RESULT_NS::detail::result_hash<RESULT_NS::Result<T, E, OkSentinel, ErrSentinel>> {};
+
+}  // namespace std
+
+#undef RESULT_THREE_WAY_COMPARISON
+#undef RESULT_ERROR
+#undef RESULT_ASSUME
+#undef RESULT_COLD
+#undef RESULT_SITE_PARAM
+#undef RESULT_SITE_NEXT_PARAM
+#undef RESULT_COUNT_ERR
+#undef RESULT_COUNT_UNWRAP
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_CORE_HPP_
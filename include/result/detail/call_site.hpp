@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_CALL_SITE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_CALL_SITE_HPP_
+
+#include <cstdint>
+
+// The call site of an Err(...) construction or an unwrap() call, captured by a defaulted trailing
+// parameter that Err() and unwrap() only take when RESULT_ENABLE_SITE_COUNTERS is defined. The
+// counting and the plain build declare different overloads, so define the macro for all
+// translation units of a program or for none.
+
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1926)
+#    define RESULT_CALL_SITE_FILE __builtin_FILE()
+#    define RESULT_CALL_SITE_LINE __builtin_LINE()
+#else
+#    define RESULT_CALL_SITE_FILE ""
+#    define RESULT_CALL_SITE_LINE 0
+#endif
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+namespace detail {
+
+struct call_site {
+    const char   *file;
+    std::uint32_t line;
+
+    static constexpr call_site current(const char   *file = RESULT_CALL_SITE_FILE,
+                                       std::uint32_t line = RESULT_CALL_SITE_LINE) noexcept {
+        return {file, line};
+    }
+};
+
+}  // namespace detail
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#undef RESULT_CALL_SITE_FILE
+#undef RESULT_CALL_SITE_LINE
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_CALL_SITE_HPP_
@@ -41,11 +41,11 @@ remain subject to the Boost Software License 1.0.
 #include <climits>
 #include <cstdint>      // required for std::uint64_t etc.
 #include <cstring>      // required for memcpy
-#include <functional>   // required for std::hash and std::invoke
 #include <limits>       // required for std::numeric_limits
-#include <optional>     // required for std::nullopt etc.
+#include <optional>     // required for std::nullopt etc., and declares std::hash
 #include <string_view>  // required for enum sentinel resolve
 #include <type_traits>
+#include <utility>      // required for std::index_sequence
 
 // In principle the following headers are required, but we rely on the standard header <optional> to
 // include the necessary pieces from the omitted headers. This is a build performance optimization,
@@ -329,6 +329,36 @@ struct value_conditional<false, val1, val2> {
     static constexpr auto value = val2;
 };
 
+// std::invoke without <functional>, which is among the most expensive standard headers to parse.
+// Covers callables and pointers to members applied to objects, references and (smart) pointers;
+// std::reference_wrapper arguments to pointers to members are not unwrapped.
+template <class M, class C, class Obj, class... Args>
+constexpr decltype(auto) invoke_member(M C::*pm, Obj &&obj, Args &&...args) {
+    if constexpr (std::is_base_of_v<C, my_remove_cvref_t<Obj>>) {
+        if constexpr (std::is_function_v<M>) {
+            return (std::forward<Obj>(obj).*pm)(std::forward<Args>(args)...);
+        } else {
+            return std::forward<Obj>(obj).*pm;
+        }
+    } else {
+        if constexpr (std::is_function_v<M>) {
+            return ((*std::forward<Obj>(obj)).*pm)(std::forward<Args>(args)...);
+        } else {
+            return (*std::forward<Obj>(obj)).*pm;
+        }
+    }
+}
+
+template <class F, class... Args>
+constexpr decltype(auto) invoke(F &&f, Args &&...args) noexcept(
+    std::is_nothrow_invocable_v<F, Args...>) {
+    if constexpr (std::is_member_pointer_v<my_remove_cvref_t<F>>) {
+        return invoke_member(f, std::forward<Args>(args)...);
+    } else {
+        return std::forward<F>(f)(std::forward<Args>(args)...);
+    }
+}
+
 // Helpers for the std::hash specializations.
 // Cannot use std::enable_if_t<..., optional> directly because it results in a compiler error 'the
 // template parameter not used or deducible in partial specialization'.
@@ -528,6 +558,27 @@ struct SentinelForExploitingUnusedBits<T *> {
     static_assert(sizeof(value) == sizeof(T *));
     static_assert(value % 2 == 1);
 };
+
+// Range of unused pointer bit patterns: every word whose upper 32 bits equal high_word is an
+// invalid address, which leaves the lower 32 bits free to carry a payload (e.g. an error discriminant).
+template <typename T>
+struct SentinelRangeForExploitingUnusedBits;
+
+#        if defined(TINY_OPTIONAL_X64) || defined(TINY_OPTIONAL_AARCH64)
+template <typename T>
+struct SentinelRangeForExploitingUnusedBits<T *> {
+#            if defined(TINY_OPTIONAL_X64)
+    // 0x8000'0000'xxxx'xxxx is non-canonical for both 48-bit and 57-bit addressing.
+    static constexpr std::uint32_t high_word = 0x8000'0000U;
+#            else
+    // 0x00ff'0000'xxxx'xxxx has an untagged top byte but lies above any 48/52-bit address.
+    static constexpr std::uint32_t high_word = 0x00ff'0000U;
+#            endif
+
+    static_assert(sizeof(T *) == 2 * sizeof(high_word));
+    static_assert((SentinelForExploitingUnusedBits<T *>::value >> 32) != high_word);
+};
+#        endif
 #    endif
 
 //====================================================================================
@@ -547,10 +598,6 @@ struct SentinelForExploitingUnusedBits<T *> {
 template <class E>
 using EnumUnderlyingT = typename std::underlying_type<E>::type;
 
-constexpr bool string_view_contains(std::string_view s, std::string_view needle) noexcept {
-    return s.find(needle) != std::string_view::npos;
-}
-
 constexpr std::string_view string_view_after(std::string_view s, std::string_view marker) noexcept {
     auto const pos = s.find(marker);
     if (pos == std::string_view::npos) {
@@ -559,57 +606,21 @@ constexpr std::string_view string_view_after(std::string_view s, std::string_vie
     return s.substr(pos + marker.size());
 }
 
-constexpr std::string_view string_view_before_any(std::string_view s, std::string_view a,
-                                                  std::string_view b, std::string_view c) noexcept {
-    auto end = s.size();
-
-    auto const pa = s.find(a);
-    if (pa != std::string_view::npos && pa < end) {
-        end = pa;
-    }
-
-    auto const pb = s.find(b);
-    if (pb != std::string_view::npos && pb < end) {
-        end = pb;
-    }
-
-    auto const pc = s.find(c);
-    if (pc != std::string_view::npos && pc < end) {
-        end = pc;
-    }
-
-    return s.substr(0, end);
-}
-
-constexpr bool looks_like_named_enumerator(std::string_view fragment) noexcept {
-    if (fragment.empty()) {
-        return false;
-    }
-
-    // unnamed enum values are commonly rendered as:
-    //   (Enum)123
-    //   static_cast<Enum>(123)
-    //   Enum{123}
-    //
-    // named enumerators are commonly rendered as:
-    //   Enum::value
-    if (string_view_contains(fragment, "(")) {
-        return false;
-    }
-
-    if (string_view_contains(fragment, "{")) {
-        return false;
-    }
-
-    if (string_view_contains(fragment, "static_cast")) {
+// Unnamed values are rendered as a cast, "(Enum)123", or as a plain number. Named enumerators are
+// rendered as "Enum::value", or as "value" for unscoped enums.
+constexpr bool is_named_enum_entry(std::string_view entry) noexcept {
+    if (entry.empty()) {
         return false;
     }
 
-    return string_view_contains(fragment, "::");
+    const char c = entry.front();
+    return c != '(' && c != '-' && (c < '0' || c > '9');
 }
 
-template <class E, E value>
-constexpr std::string_view wrapped_enum_value_name() noexcept {
+// Renders a whole batch of candidate values in one signature, so probing N candidates costs one
+// instantiation instead of N.
+template <class E, E... Values>
+constexpr std::string_view wrapped_enum_value_list() noexcept {
     static_assert(std::is_enum_v<E>, "E must be an enum type.");
 
 #    if defined(__clang__) || defined(__GNUC__)
@@ -632,55 +643,64 @@ constexpr std::string_view wrapped_type_name() noexcept {
 #    endif
 }
 
-template <class E, E value>
-constexpr std::string_view enum_value_fragment() noexcept {
-    constexpr auto s = wrapped_enum_value_name<E, value>();
+inline constexpr std::size_t no_free_enum_entry = static_cast<std::size_t>(-1);
 
-#    if defined(__clang__)
-    constexpr auto tail = string_view_after(s, "value = ");
-    if constexpr (!tail.empty()) {
-        return string_view_before_any(tail, "]", ";", ",");
-    } else {
-        constexpr auto fallback_tail = string_view_after(s, "V = ");
-        return string_view_before_any(fallback_tail, "]", ";", ",");
-    }
+// Index of the first unnamed value in a signature produced by wrapped_enum_value_list, or
+// no_free_enum_entry. The pack is rendered as "Values = {a, b, ...}" by GCC and as
+// "Values = <a, b, ...>" by Clang. Entries are split at top-level commas only, because enum type
+// names can contain template argument lists. A signature that does not parse into exactly `count`
+// entries yields no_free_enum_entry, so the search fails loudly instead of picking a named value.
+constexpr std::size_t first_unnamed_enum_entry(std::string_view signature,
+                                               std::size_t      count) noexcept {
+#    if defined(__clang__) || defined(__GNUC__)
+    auto list = string_view_after(signature, "Values = ");
+    if (list.size() < 2) {
+        return no_free_enum_entry;
+    }
+
+    list.remove_prefix(1);
+
+    std::size_t first_unnamed = no_free_enum_entry;
+    std::size_t entries = 0;
+    std::size_t begin = 0;
+    int         depth = 0;
+
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        const char c = list[i];
+        const bool closes_list = depth == 0 && (c == '}' || c == '>');
+
+        if (c == '(' || c == '<' || c == '{' || c == '[') {
+            ++depth;
+        } else if (!closes_list && (c == ')' || c == '>' || c == '}' || c == ']')) {
+            --depth;
+        } else if (closes_list || (depth == 0 && c == ',')) {
+            auto entry = list.substr(begin, i - begin);
+            while (!entry.empty() && entry.front() == ' ') {
+                entry.remove_prefix(1);
+            }
 
-#    elif defined(__GNUC__)
-    constexpr auto tail1 = string_view_after(s, "value = ");
-    if constexpr (!tail1.empty()) {
-        return string_view_before_any(tail1, "]", ";", ",");
-    } else {
-        constexpr auto tail2 = string_view_after(s, "E value = ");
-        if constexpr (!tail2.empty()) {
-            return string_view_before_any(tail2, "]", ";", ",");
-        } else {
-            constexpr auto tail3 = string_view_after(s, "V = ");
-            return string_view_before_any(tail3, "]", ";", ",");
+            if (first_unnamed == no_free_enum_entry && !is_named_enum_entry(entry)) {
+                first_unnamed = entries;
+            }
+
+            ++entries;
+            begin = i + 1;
+
+            if (closes_list) {
+                break;
+            }
         }
     }
 
-#    elif defined(_MSC_VER)
-    // Minimal MSVC support. Production code should parse the exact template argument here.
-    return s;
+    return entries == count ? first_unnamed : no_free_enum_entry;
+#    else
+    // Minimal MSVC support: the signature is not parsed and the first candidate is taken.
+    static_cast<void>(signature);
+    static_cast<void>(count);
+    return 0;
 #    endif
 }
 
-template <class E, E value>
-constexpr bool is_named_enum_value() noexcept {
-    constexpr auto fragment = enum_value_fragment<E, value>();
-    return looks_like_named_enumerator(fragment);
-}
-
-template <class E, EnumUnderlyingT<E> candidate>
-constexpr bool is_named_enum_integral_value() noexcept {
-    return is_named_enum_value<E, static_cast<E>(candidate)>();
-}
-
-template <class E, EnumUnderlyingT<E> candidate>
-constexpr bool is_free_enum_integral_value() noexcept {
-    return !is_named_enum_integral_value<E, candidate>();
-}
-
 //------------------------------------------------------------------------------
 // Deterministic pseudo-random probing for larger enum types
 //------------------------------------------------------------------------------
@@ -707,101 +727,83 @@ constexpr std::uint64_t splitmix64(std::uint64_t x) noexcept {
 template <class T>
 inline constexpr std::uint64_t type_hash = fnv1a_64(wrapped_type_name<T>());
 
-template <class E, std::size_t I>
-struct HashedEnumCandidate {
-    using UnderlyingType = EnumUnderlyingT<E>;
-
-    static constexpr UnderlyingType value =
-        static_cast<UnderlyingType>(splitmix64(type_hash<E> + static_cast<std::uint64_t>(I)));
-};
-
-template <class E, std::size_t I, std::size_t Len>
-struct FindHashedEnumSentinel {
-    using UnderlyingType = EnumUnderlyingT<E>;
-
-    static constexpr UnderlyingType candidate = HashedEnumCandidate<E, I>::value;
-    static constexpr E              value = [] {
-        if constexpr (is_free_enum_integral_value<E, candidate>()) {
-            return static_cast<E>(candidate);
-        } else {
-            return FindHashedEnumSentinel<E, I + 1, Len>::value;
-        }
-    }();
-};
-
-template <class E, std::size_t Len>
-struct FindHashedEnumSentinel<E, Len, Len> {
+template <class E, std::size_t N>
+struct HashedEnumCandidates {
     using UnderlyingType = EnumUnderlyingT<E>;
 
-    static constexpr UnderlyingType candidate = HashedEnumCandidate<E, Len>::value;
-    static constexpr E              value = [] {
-        static_assert(is_free_enum_integral_value<E, candidate>(),
-                      "Could not find a free enum sentinel value in the pseudo-random probe range. "
-                                   "Specify the sentinel manually.");
-
-        return static_cast<E>(candidate);
-    }();
-};
-
-template <class E, std::size_t N>
-struct FindHashedEnumSentinelWithProbeCount {
     static_assert(N > 0, "probe_count must be greater than zero.");
 
-    static constexpr E value = FindHashedEnumSentinel<E, 0, N - 1>::value;
+    static constexpr std::size_t count = N;
+
+    static constexpr UnderlyingType value(std::size_t i) noexcept {
+        return static_cast<UnderlyingType>(splitmix64(type_hash<E> + static_cast<std::uint64_t>(i)));
+    }
 };
 
 //------------------------------------------------------------------------------
 // Exhaustive scan for 1-byte enum types
 //------------------------------------------------------------------------------
 
-template <class E, int I, int Len>
-struct FindLinearEnumSentinel {
+template <class E>
+struct LinearEnumCandidates {
     using UnderlyingType = EnumUnderlyingT<E>;
 
-    static constexpr E value = [] {
-        constexpr auto candidate = static_cast<UnderlyingType>(I);
+    static_assert(sizeof(UnderlyingType) == 1,
+                  "LinearEnumCandidates only supports enums with 1-byte underlying types.");
 
-        if constexpr (is_free_enum_integral_value<E, candidate>()) {
-            return static_cast<E>(candidate);
-        } else {
-            return FindLinearEnumSentinel<E, I + 1, Len>::value;
-        }
-    }();
-};
+    static constexpr int first = std::is_signed_v<UnderlyingType>
+                                     ? static_cast<int>(std::numeric_limits<UnderlyingType>::min())
+                                     : 0;
 
-template <class E, int Len>
-struct FindLinearEnumSentinel<E, Len, Len> {
-    using UnderlyingType = EnumUnderlyingT<E>;
+    static constexpr std::size_t count = std::size_t{1} << 8;
 
-    static constexpr E value = [] {
-        constexpr auto candidate = static_cast<UnderlyingType>(Len);
+    static constexpr UnderlyingType value(std::size_t i) noexcept {
+        return static_cast<UnderlyingType>(first + static_cast<int>(i));
+    }
+};
 
-        static_assert(is_free_enum_integral_value<E, candidate>(),
-                      "Could not find a free enum sentinel value. "
-                      "The enum probably uses every value of its 1-byte underlying type.");
+//------------------------------------------------------------------------------
+// Batched search
+//------------------------------------------------------------------------------
 
-        return static_cast<E>(candidate);
-    }();
-};
+template <class E, class Candidates, std::size_t Begin, std::size_t... Is>
+constexpr std::size_t probe_enum_batch(std::index_sequence<Is...>) noexcept {
+    constexpr auto signature =
+        wrapped_enum_value_list<E, static_cast<E>(Candidates::value(Begin + Is))...>();
 
-template <class E>
-struct FindSmallEnumSentinel {
-    using UnderlyingType = EnumUnderlyingT<E>;
+    return first_unnamed_enum_entry(signature, sizeof...(Is));
+}
 
-    static_assert(sizeof(UnderlyingType) == 1,
-                  "FindSmallEnumSentinel only supports enums with 1-byte underlying types.");
+// Probes the candidates in batches of doubling size (8, 16, 32, ...). A free value among the
+// first few candidates costs a single small instantiation, and even a full 256-value scan needs
+// only six, instead of one instantiation per candidate.
+template <class E, class Candidates, std::size_t Begin = 0, std::size_t Batch = 8>
+constexpr E find_enum_sentinel() noexcept {
+    constexpr std::size_t remaining = Candidates::count - Begin;
+    constexpr std::size_t size = Batch < remaining ? Batch : remaining;
+    constexpr std::size_t hit =
+        probe_enum_batch<E, Candidates, Begin>(std::make_index_sequence<size>{});
+
+    if constexpr (hit != no_free_enum_entry) {
+        return static_cast<E>(Candidates::value(Begin + hit));
+    } else {
+        static_assert(size < remaining,
+                      "Could not find a free enum sentinel value among the probed candidates. "
+                      "Specify the sentinel manually.");
 
-    static constexpr auto first = std::is_signed_v<UnderlyingType>
-                                      ? static_cast<int>(std::numeric_limits<UnderlyingType>::min())
-                                      : 0;
-    static constexpr int  last = static_cast<int>(std::numeric_limits<UnderlyingType>::max());
-    static constexpr E    value = FindLinearEnumSentinel<E, first, last>::value;
-};
+        if constexpr (size < remaining) {
+            return find_enum_sentinel<E, Candidates, Begin + size, Batch * 2>();
+        } else {
+            return static_cast<E>(Candidates::value(0));
+        }
+    }
+}
 
 //------------------------------------------------------------------------------
 // Main enum sentinel selector
 //------------------------------------------------------------------------------
 
+// Evaluated once per enum type; automatic_enum_sentinel<E> memoizes the result.
 template <class E>
 struct AutomaticEnumSentinelImpl {
     static_assert(std::is_enum_v<E>, "E must be an enum type.");
@@ -812,9 +814,9 @@ struct AutomaticEnumSentinelImpl {
     static constexpr std::size_t hash_probe_count = std::numeric_limits<std::uint8_t>::max();
     static constexpr E           value = [] {
         if constexpr (sizeof(UnderlyingType) == 1) {
-            return FindSmallEnumSentinel<E>::value;
+            return find_enum_sentinel<E, LinearEnumCandidates<E>>();
         } else {
-            return FindHashedEnumSentinelWithProbeCount<E, hash_probe_count>::value;
+            return find_enum_sentinel<E, HashedEnumCandidates<E, hash_probe_count>>();
         }
     }();
 };
@@ -1214,6 +1216,16 @@ inline constexpr bool SentinelForExploitingUnusedBitsIsKnown =
 #else
     false;
 #endif
+
+// True if SentinelRangeForExploitingUnusedBits is defined for the payload type.
+template <class PayloadType>
+inline constexpr bool SentinelRangeForExploitingUnusedBitsIsKnown =
+#if !defined(TINY_OPTIONAL_USE_SEPARATE_BOOL_INSTEAD_OF_UNUSED_BITS) && \
+    (defined(TINY_OPTIONAL_X64) || defined(TINY_OPTIONAL_AARCH64))
+    std::is_pointer_v<PayloadType>;
+#else
+    false;
+#endif
 }  // namespace impl
 TINY_OPTIONAL_INLINE_NS_END
 
@@ -1569,12 +1581,12 @@ struct StorageBase {
                                                       std::invoke_result_t<FuncT, ArgT>>) {
             ::new (const_cast<void *>(
                 static_cast<void volatile const *>(std::addressof(GetPayload()))))
-                PayloadType(std::invoke(std::forward<FuncT>(func), std::forward<ArgT>(arg)));
+                PayloadType(impl::invoke(std::forward<FuncT>(func), std::forward<ArgT>(arg)));
         } else {
             InitializeIsEmptyFlagScope initScope{*this};
             ::new (const_cast<void *>(
                 static_cast<void volatile const *>(std::addressof(GetPayload()))))
-                PayloadType(std::invoke(std::forward<FuncT>(func), std::forward<ArgT>(arg)));
+                PayloadType(impl::invoke(std::forward<FuncT>(func), std::forward<ArgT>(arg)));
             initScope.doNotInitialize = true;
         }
 
@@ -2117,7 +2129,7 @@ class TinyOptionalImpl
         static_assert(IsSomeOptional<ReturnTypeOfF>,
                       "The standard requires 'f' to return an optional.");
         if (has_value()) {
-            return std::invoke(std::forward<F>(f), **this);
+            return impl::invoke(std::forward<F>(f), **this);
         } else {
             return ReturnTypeOfF();
         }
@@ -2129,7 +2141,7 @@ class TinyOptionalImpl
         static_assert(IsSomeOptional<ReturnTypeOfF>,
                       "The standard requires 'f' to return an optional.");
         if (has_value()) {
-            return std::invoke(std::forward<F>(f), **this);
+            return impl::invoke(std::forward<F>(f), **this);
         } else {
             return ReturnTypeOfF();
         }
@@ -2141,7 +2153,7 @@ class TinyOptionalImpl
         static_assert(IsSomeOptional<ReturnTypeOfF>,
                       "The standard requires 'f' to return an optional.");
         if (has_value()) {
-            return std::invoke(std::forward<F>(f), std::move(**this));
+            return impl::invoke(std::forward<F>(f), std::move(**this));
         } else {
             return ReturnTypeOfF();
         }
@@ -2153,7 +2165,7 @@ class TinyOptionalImpl
         static_assert(IsSomeOptional<ReturnTypeOfF>,
                       "The standard requires 'f' to return an optional.");
         if (has_value()) {
-            return std::invoke(std::forward<F>(f), std::move(**this));
+            return impl::invoke(std::forward<F>(f), std::move(**this));
         } else {
             return ReturnTypeOfF();
         }
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_USDT_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_USDT_HPP_
+
+// Minimal SystemTap/USDT probe emitter, compatible with the note layout of <sys/sdt.h> but without
+// depending on it. A probe site is a single NOP; its address, provider, name and argument
+// locations are recorded in an ELF .note.stapsdt section where perf, bpftrace and friends find
+// them. Unattached probes therefore cost one NOP and no data movement for argument-less probes.
+//
+// Only enabled for LP64 ELF targets (x86-64 and AArch64 Linux) with RESULT_ENABLE_USDT defined.
+// Everywhere else the probe macros expand to nothing.
+
+#if defined(RESULT_ENABLE_USDT) && defined(__linux__) && \
+    (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__aarch64__))
+#    define RESULT_USDT_ENABLED
+#endif
+
+#ifdef RESULT_USDT_ENABLED
+
+#    include <cstdint>
+
+#    define RESULT_USDT_STR_(x) #x
+#    define RESULT_USDT_STR(x)  RESULT_USDT_STR_(x)
+
+#    if defined(__x86_64__)
+#        define RESULT_USDT_ARG_CONSTRAINT "nor"
+#    else
+#        define RESULT_USDT_ARG_CONSTRAINT "r"
+#    endif
+
+// clang-format off
+#    define RESULT_USDT_NOTE(provider, name, args)                                            \
+        "990: nop\n"                                                                          \
+        ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                         \
+        ".balign 4\n"                                                                         \
+        ".4byte 992f-991f, 994f-993f, 3\n"                                                    \
+        "991: .asciz \"stapsdt\"\n"                                                           \
+        "992: .balign 4\n"                                                                    \
+        "993: .8byte 990b\n"                                                                  \
+        ".8byte _.stapsdt.base\n"                                                             \
+        ".8byte 0\n"                                                                          \
+        ".asciz \"" RESULT_USDT_STR(provider) "\"\n"                                          \
+        ".asciz \"" RESULT_USDT_STR(name) "\"\n"                                              \
+        ".asciz \"" args "\"\n"                                                               \
+        "994: .balign 4\n"                                                                    \
+        ".popsection\n"                                                                       \
+        ".ifndef _.stapsdt.base\n"                                                            \
+        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"               \
+        ".weak _.stapsdt.base\n"                                                              \
+        ".hidden _.stapsdt.base\n"                                                            \
+        "_.stapsdt.base: .space 1\n"                                                          \
+        ".size _.stapsdt.base, 1\n"                                                           \
+        ".popsection\n"                                                                       \
+        ".endif\n"
+// clang-format on
+
+#    define RESULT_USDT_PROBE0(provider, name) \
+        __asm__ __volatile__(RESULT_USDT_NOTE(provider, name, "") ::)
+
+// The pointer argument is passed as a signed 64-bit value ("-8@<location>").
+#    define RESULT_USDT_PROBE1(provider, name, arg0)                      \
+        __asm__ __volatile__(RESULT_USDT_NOTE(provider, name, "-8@%[a0]") \
+                             :                                            \
+                             : [a0] RESULT_USDT_ARG_CONSTRAINT(           \
+                                 static_cast<long long>(reinterpret_cast<std::intptr_t>(arg0))))
+
+#else
+
+#    define RESULT_USDT_PROBE0(provider, name)       static_cast<void>(0)
+#    define RESULT_USDT_PROBE1(provider, name, arg0) static_cast<void>(0)
+
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_DETAIL_USDT_HPP_
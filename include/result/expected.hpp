@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_EXPECTED_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_EXPECTED_HPP_
+
+#if __has_include(<expected>)
+#    include <expected>
+#endif
+
+#if !defined(__cpp_lib_expected) || __cpp_lib_expected < 202202L
+#    error "result/expected.hpp requires C++23 std::expected."
+#endif
+
+#include <type_traits>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Conversions
+// =================================================================================================
+
+// Result<T, E> <-> std::expected<T, E>, including T = void. Both sides are a tagged union of the
+// same two types, so a conversion moves the payload once, straight into its destination; for
+// trivially copyable payloads it compiles down to copying the bytes. std::expected has no
+// reference or void error types, so Result<T &, E>, Result<T, E &> and Result<T, void> do not
+// convert.
+template <typename T, typename E, auto OkSentinel, auto ErrSentinel>
+[[nodiscard]] std::expected<T, E> to_expected(Result<T, E, OkSentinel, ErrSentinel> &&result) {
+    static_assert(!std::is_reference_v<T> && !std::is_reference_v<E>,
+                  "std::expected cannot hold references.");
+    static_assert(!std::is_void_v<E>, "std::expected needs an error type.");
+
+    if (result.is_ok()) {
+        if constexpr (std::is_void_v<T>) {
+            return std::expected<T, E>();
+        } else {
+            return std::expected<T, E>(std::in_place, std::move(result.unwrap_ref()));
+        }
+    }
+
+    return std::expected<T, E>(std::unexpect, std::move(result.unwrap_err_ref()));
+}
+
+template <typename T, typename E>
+[[nodiscard]] Result<T, E> from_expected(std::expected<T, E> &&expected) {
+    if (expected.has_value()) {
+        if constexpr (std::is_void_v<T>) {
+            return Ok();
+        } else {
+            return Ok(std::move(*expected));
+        }
+    }
+
+    return Err(std::move(expected.error()));
+}
+
+// =================================================================================================
+// and_then() adapter
+// =================================================================================================
+
+template <typename Fn>
+class expected_fn {
+   public:
+    explicit expected_fn(Fn fn) : m_fn(std::move(fn)) {}
+
+    template <typename... Args>
+    auto operator()(Args &&...args) {
+        using Ret = std::invoke_result_t<Fn &, Args...>;
+        static_assert(std::is_same_v<Ret, std::expected<typename Ret::value_type,
+                                                        typename Ret::error_type>>,
+                      "adapt_expected() callable must return a std::expected.");
+
+        return from_expected(detail::invoke(m_fn, std::forward<Args>(args)...));
+    }
+
+   private:
+    Fn m_fn;
+};
+
+// Wraps a std::expected-returning callable so that it can be used where a Result-returning one is
+// required, e.g. `result.and_then(adapt_expected(parse))`.
+template <typename Fn>
+[[nodiscard]] auto adapt_expected(Fn &&fn) {
+    return expected_fn<std::decay_t<Fn>>(std::forward<Fn>(fn));
+}
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_EXPECTED_HPP_
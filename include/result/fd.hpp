@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_FD_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_FD_HPP_
+
+#if !__has_include(<unistd.h>)
+#    error "result/fd.hpp requires a POSIX system."
+#endif
+
+#include <unistd.h>
+
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "niche.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Owning file descriptor
+// =================================================================================================
+
+// Move-only owner of a POSIX file descriptor, closed on destruction. -1 means "no descriptor" and
+// doubles as the niche, so Result<Fd, void> and Result<Fd, E> with an empty E are sizeof(int).
+// Moved-from descriptors hold -1 as well, which is safe because destroying them is a no-op.
+class Fd {
+   public:
+    Fd() noexcept = default;
+
+    explicit Fd(int fd) noexcept : m_fd(fd) {}
+
+    Fd(const Fd &) = delete;
+    Fd &operator=(const Fd &) = delete;
+
+    Fd(Fd &&other) noexcept : m_fd(std::exchange(other.m_fd, -1)) {}
+
+    Fd &operator=(Fd &&other) noexcept {
+        if (this != &other)
+            reset(std::exchange(other.m_fd, -1));
+
+        return *this;
+    }
+
+    ~Fd() { reset(); }
+
+    [[nodiscard]] int get() const noexcept { return m_fd; }
+
+    [[nodiscard]] bool valid() const noexcept { return m_fd >= 0; }
+
+    explicit operator bool() const noexcept { return valid(); }
+
+    // Gives up ownership without closing.
+    [[nodiscard]] int release() noexcept { return std::exchange(m_fd, -1); }
+
+    void reset(int fd = -1) noexcept {
+        if (m_fd >= 0)
+            ::close(m_fd);
+
+        m_fd = fd;
+    }
+
+   private:
+    friend struct niche_traits<Fd>;
+
+    int m_fd = -1;
+};
+
+template <>
+struct niche_traits<Fd> : member_niche<&Fd::m_fd, -1> {};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_FD_HPP_
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_MAPPED_FILE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_MAPPED_FILE_HPP_
+
+#if !__has_include(<sys/mman.h>)
+#    error "result/mapped_file.hpp requires a POSIX system."
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#    include <span>
+#endif
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+#include "fd.hpp"
+#include "posix.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// MappedFile
+// =================================================================================================
+
+// Access pattern hint, passed to madvise for the whole mapping.
+enum class MapAccess {
+    normal,
+    sequential,  // MADV_SEQUENTIAL: aggressive read-ahead, pages freed soon after use
+    random,      // MADV_RANDOM: no read-ahead, e.g. for index lookups
+};
+
+struct MapOptions {
+    MapAccess access = MapAccess::normal;
+
+    // Asks for transparent huge pages (MADV_HUGEPAGE) where the kernel supports them for file
+    // mappings. Best effort: a kernel that refuses keeps using regular pages.
+    bool huge_pages = false;
+};
+
+// Read-only, private mapping of a whole file. Views into it are zero-copy and stay valid as long
+// as the MappedFile lives; the descriptor is closed once the mapping exists. Empty files map to an
+// empty range without calling mmap. Move-only.
+class MappedFile {
+   public:
+    [[nodiscard]] static Result<MappedFile, Errno> open(const char *path,
+                                                        MapOptions options = {}) noexcept {
+        auto fd = posix::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd.is_err())
+            return Err(std::move(fd).unwrap_err());
+
+        return map(fd.unwrap_ref().get(), options);
+    }
+
+    // Maps the file behind a descriptor the caller keeps owning.
+    [[nodiscard]] static Result<MappedFile, Errno> map(int fd, MapOptions options = {}) noexcept {
+        auto st = posix::fstat(fd);
+        if (st.is_err())
+            return Err(std::move(st).unwrap_err());
+
+        const auto size = static_cast<std::size_t>(st.unwrap_ref().st_size);
+        if (size == 0)
+            return Ok(MappedFile());
+
+        auto addr = posix::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr.is_err())
+            return Err(std::move(addr).unwrap_err());
+
+        MappedFile file(static_cast<const std::byte *>(addr.unwrap_ref()), size);
+
+        if (auto advised = file.advise(options.access); advised.is_err())
+            return Err(std::move(advised).unwrap_err());
+
+#ifdef MADV_HUGEPAGE
+        if (options.huge_pages)
+            (void)posix::madvise(addr.unwrap_ref(), size, MADV_HUGEPAGE);
+#endif
+
+        return Ok(std::move(file));
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    MappedFile &operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+
+        return *this;
+    }
+
+    ~MappedFile() { unmap(); }
+
+    [[nodiscard]] const std::byte *data() const noexcept { return m_data; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    // Changes the access hint, e.g. to random after a sequential scan of the header.
+    Result<void, Errno> advise(MapAccess access) const noexcept {
+        if (m_size == 0 || access == MapAccess::normal)
+            return Ok();
+
+        const int advice = access == MapAccess::sequential ? MADV_SEQUENTIAL : MADV_RANDOM;
+        return posix::madvise(const_cast<std::byte *>(m_data), m_size, advice);
+    }
+
+    // The whole file as text, e.g. for a config parser.
+    [[nodiscard]] std::string_view view() const noexcept {
+        return {reinterpret_cast<const char *>(m_data), m_size};
+    }
+
+    // [offset, offset + length) as text, or ERANGE if the range does not lie inside the file.
+    [[nodiscard]] Result<std::string_view, Errno> read_view(std::size_t offset,
+                                                            std::size_t length) const noexcept {
+        if (!in_bounds(offset, length))
+            return Err(Errno{ERANGE});
+
+        return Ok(std::string_view(reinterpret_cast<const char *>(m_data) + offset, length));
+    }
+
+#ifdef __cpp_lib_span
+    // [offset, offset + length) as bytes, or ERANGE if the range does not lie inside the file.
+    [[nodiscard]] Result<std::span<const std::byte>, Errno> read_span(
+        std::size_t offset, std::size_t length) const noexcept {
+        if (!in_bounds(offset, length))
+            return Err(Errno{ERANGE});
+
+        return Ok(std::span<const std::byte>(m_data + offset, length));
+    }
+#endif
+
+   private:
+    MappedFile() noexcept = default;
+
+    MappedFile(const std::byte *data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+    [[nodiscard]] bool in_bounds(std::size_t offset, std::size_t length) const noexcept {
+        return offset <= m_size && length <= m_size - offset;
+    }
+
+    void unmap() noexcept {
+        if (m_data)
+            ::munmap(const_cast<std::byte *>(m_data), m_size);
+    }
+
+    const std::byte *m_data = nullptr;
+    std::size_t      m_size = 0;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_MAPPED_FILE_HPP_
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_NICHE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_NICHE_HPP_
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "detail/optional.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Niche customization point
+// =================================================================================================
+
+// Specialize niche_traits<T> to declare a bit pattern (a "niche") that no valid T ever holds.
+// Result then encodes its empty side in that pattern instead of a separate discriminant, so
+// Result<T, void>, Result<void, T> and Result<T, Empty> (Empty being an empty class) are exactly
+// sizeof(T). A specialization provides
+//
+//     static void set_niche(T *storage) noexcept;       // writes the niche into raw storage
+//     static bool is_niche(const T *storage) noexcept;  // true if storage holds the niche
+//
+// is_niche() is also called on live objects. No T is constructed for the niche and none is
+// destroyed, so a niche may only coincide with a state (e.g. moved-from) whose destructor is a
+// no-op. Specialize right after the definition of T, as with std::hash.
+template <typename T, typename Enable = void>
+struct niche_traits {};
+
+template <typename T, typename = void>
+struct has_niche : std::false_type {};
+
+template <typename T>
+struct has_niche<T, std::void_t<decltype(niche_traits<T>::set_niche(std::declval<T *>())),
+                                decltype(niche_traits<T>::is_niche(std::declval<const T *>()))>>
+    : std::true_type {};
+
+template <typename T>
+inline constexpr bool has_niche_v = has_niche<T>::value;
+
+namespace detail {
+
+// std::addressof without <memory>, which under C++20 drags <ostream> into every includer.
+template <typename T>
+constexpr T *address_of(T &value) noexcept {
+    return __builtin_addressof(value);
+}
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename C, typename M>
+struct member_pointer_traits<M C::*> {
+    using class_type = C;
+    using member_type = M;
+};
+
+}  // namespace detail
+
+// Niche for a class with a member that never holds `Value`, e.g. a descriptor that is never -1:
+//
+//     template <> struct niche_traits<Handle> : member_niche<&Handle::fd, -1> {};
+template <auto Member, auto Value>
+struct member_niche {
+    using class_type = typename detail::member_pointer_traits<decltype(Member)>::class_type;
+    using member_type = typename detail::member_pointer_traits<decltype(Member)>::member_type;
+
+    static_assert(std::is_trivially_destructible_v<member_type>,
+                  "member_niche requires a trivially destructible member.");
+
+    static void set_niche(class_type *storage) noexcept {
+        ::new (static_cast<void *>(detail::address_of(storage->*Member))) member_type(Value);
+    }
+
+    static bool is_niche(const class_type *storage) noexcept { return storage->*Member == Value; }
+};
+
+// Niche for a type that is never equal to `Value`, e.g. an id that is never 0:
+//
+//     template <typename Tag>
+//     struct niche_traits<StrongId<Tag>> : value_niche<StrongId<Tag>, 0> {};
+template <typename T, auto Value>
+struct value_niche {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "value_niche requires a trivially destructible type.");
+
+    static void set_niche(T *storage) noexcept { ::new (static_cast<void *>(storage)) T(Value); }
+
+    static bool is_niche(const T *storage) noexcept { return *storage == T(Value); }
+};
+
+// =================================================================================================
+// Pointer niches
+// =================================================================================================
+
+// Raw pointers. The niches for standard library types are opt-in, see std_niches.hpp.
+
+namespace detail {
+
+template <typename Carrier>
+inline constexpr bool has_unused_bits_v =
+    tiny::impl::SentinelForExploitingUnusedBitsIsKnown<Carrier>;
+
+// Niche for a T whose object representation is exactly one Carrier (a pointer or floating point
+// type), using the unused bit pattern tiny::optional already reserves for Carrier.
+template <typename T, typename Carrier>
+struct representation_niche {
+    using pattern = tiny::impl::SentinelForExploitingUnusedBits<Carrier>;
+
+    static_assert(sizeof(T) == sizeof(Carrier) && sizeof(pattern::value) == sizeof(Carrier),
+                  "representation_niche requires T to be laid out as a single Carrier.");
+
+    static void set_niche(T *storage) noexcept {
+        const auto bits = pattern::value;
+        std::memcpy(static_cast<void *>(storage), &bits, sizeof(bits));
+    }
+
+    // A load and an integer compare rather than memcmp, which GCC does not always fold against a
+    // niche it has just stored.
+    static bool is_niche(const T *storage) noexcept {
+        std::remove_const_t<decltype(pattern::value)> bits;
+        std::memcpy(&bits, static_cast<const void *>(storage), sizeof(bits));
+        return bits == pattern::value;
+    }
+};
+
+}  // namespace detail
+
+template <typename T>
+struct niche_traits<T *, std::enable_if_t<detail::has_unused_bits_v<T *>>>
+    : detail::representation_niche<T *, T *> {};
+
+namespace detail {
+
+// Adapts niche_traits<T> to the tiny::optional_inplace flag manipulator interface.
+template <typename T>
+struct niche_flag_manipulator {
+    static bool is_empty(const T &payload) noexcept {
+        return niche_traits<T>::is_niche(detail::address_of(payload));
+    }
+
+    static void init_empty_flag(T &uninitialized) noexcept {
+        niche_traits<T>::set_niche(detail::address_of(uninitialized));
+    }
+
+    static void invalidate_empty_flag(T &) noexcept {}
+};
+
+// Optional used by the Result storages: a registered niche wins over the tiny::optional default,
+// an explicit sentinel wins over both.
+template <typename T, auto Sentinel>
+using niche_optional_t =
+    std::conditional_t<std::is_same_v<std::decay_t<decltype(Sentinel)>, tiny::UseDefaultType> &&
+                           has_niche_v<T>,
+                       tiny::optional_inplace<T, niche_flag_manipulator<T>>,
+                       tiny::optional<T, Sentinel>>;
+
+}  // namespace detail
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_NICHE_HPP_
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_PARSE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_PARSE_HPP_
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// ParseError
+// =================================================================================================
+
+// One byte. Result<void, ParseError> is one byte as well: the automatic enum sentinel takes an
+// unnamed value as its niche. Result<T, ParseError> is trivially copyable, so it is returned in
+// registers.
+enum class ParseError : std::uint8_t {
+    empty,                // no characters at all
+    invalid,              // does not start with a number
+    out_of_range,         // a number that does not fit into T, or too many fields for parse_column
+    trailing_characters,  // a number followed by anything else
+};
+
+// sizeof(T) plus one flag byte, rounded up to alignof(T).
+static_assert(sizeof(Result<void, ParseError>) == 1);
+static_assert(sizeof(Result<std::uint8_t, ParseError>) == 2);
+static_assert(sizeof(Result<std::int32_t, ParseError>) == 8);
+
+namespace detail {
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool parse_big_endian = true;
+#else
+inline constexpr bool parse_big_endian = false;
+#endif
+
+// The next eight characters as one little-endian word, first character in the lowest byte.
+[[nodiscard]] inline std::uint64_t load_eight_chars(const char *p) noexcept {
+    std::uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+
+    if constexpr (parse_big_endian) {
+#if defined(__GNUC__) || defined(__clang__)
+        chunk = __builtin_bswap64(chunk);
+#else
+        std::uint64_t swapped = 0;
+        for (int i = 0; i < 8; ++i)
+            swapped |= ((chunk >> (8 * i)) & 0xff) << (8 * (7 - i));
+        chunk = swapped;
+#endif
+    }
+
+    return chunk;
+}
+
+// SWAR check that all eight bytes are in '0'..'9': the high nibble must be 3 before and after
+// adding 6 to every byte.
+[[nodiscard]] inline bool is_eight_digits(std::uint64_t chunk) noexcept {
+    return ((chunk & 0xf0f0f0f0f0f0f0f0) |
+            (((chunk + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) == 0x3333333333333333;
+}
+
+// Value of eight ASCII digits in three multiplications instead of eight: adjacent digits are
+// combined into pairs, then quadruples, then the full value.
+[[nodiscard]] inline std::uint32_t eight_digits_value(std::uint64_t chunk) noexcept {
+    constexpr std::uint64_t mask = 0x000000ff000000ff;
+    constexpr std::uint64_t mul1 = 100 + (std::uint64_t{1000000} << 32);
+    constexpr std::uint64_t mul2 = 1 + (std::uint64_t{10000} << 32);
+
+    chunk -= 0x3030303030303030;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+
+    return static_cast<std::uint32_t>(chunk);
+}
+
+// Value of at most 19 decimal digits, which always fits into 64 bits. False if any character is
+// not a digit; the caller then lets std::from_chars classify the input.
+[[nodiscard]] inline bool parse_digits(const char *first, const char *last,
+                                       std::uint64_t &value) noexcept {
+    std::uint64_t acc = 0;
+
+    for (; last - first >= 8; first += 8) {
+        const std::uint64_t chunk = load_eight_chars(first);
+
+        if (!is_eight_digits(chunk))
+            return false;
+
+        acc = acc * 100000000 + eight_digits_value(chunk);
+    }
+
+    for (; first != last; ++first) {
+        const auto digit = static_cast<unsigned char>(*first - '0');
+
+        if (digit > 9)
+            return false;
+
+        acc = acc * 10 + digit;
+    }
+
+    value = acc;
+    return true;
+}
+
+template <typename T>
+[[nodiscard]] Result<T, ParseError> parse_from_chars(std::string_view text) noexcept {
+    const char *last = text.data() + text.size();
+    T           value{};
+
+    const auto [ptr, ec] = std::from_chars(text.data(), last, value);
+
+    if (ec == std::errc::invalid_argument)
+        return Err(ParseError::invalid);
+
+    if (ec == std::errc::result_out_of_range)
+        return Err(ParseError::out_of_range);
+
+    if (ptr != last)
+        return Err(ParseError::trailing_characters);
+
+    return Ok(std::move(value));
+}
+
+template <typename T>
+[[nodiscard]] Result<T, ParseError> parse_integer(std::string_view text) noexcept {
+    using limits = std::numeric_limits<T>;
+
+    if constexpr (sizeof(T) <= sizeof(std::uint64_t)) {
+        const char *first = text.data();
+        const char *last = first + text.size();
+        bool        negative = false;
+
+        if constexpr (limits::is_signed) {
+            negative = *first == '-';
+            first += negative;
+        }
+
+        std::uint64_t magnitude;
+
+        if (last - first <= 19 && first != last && parse_digits(first, last, magnitude)) {
+            const std::uint64_t limit = static_cast<std::uint64_t>(limits::max()) + negative;
+
+            if (magnitude > limit)
+                return Err(ParseError::out_of_range);
+
+            return Ok(static_cast<T>(negative ? ~magnitude + 1 : magnitude));
+        }
+    }
+
+    // Leading zeros beyond 19 digits, wider types and every malformed input.
+    return parse_from_chars<T>(text);
+}
+
+}  // namespace detail
+
+// =================================================================================================
+// parse<T>
+// =================================================================================================
+
+// Parses all of `text` as a base-10 T, with the syntax of std::from_chars: an optional '-' for
+// signed types, no leading '+' or whitespace, and "inf"/"nan"/exponents for floating point types.
+// Plain digit runs of integers take a SWAR path that converts eight digits at a time; everything
+// else, including every error, goes through std::from_chars.
+template <typename T>
+[[nodiscard]] Result<T, ParseError> parse(std::string_view text) noexcept {
+    static_assert((std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+                      std::is_floating_point_v<T>,
+                  "parse<T> supports integer and floating point types.");
+
+    if (text.empty())
+        return Err(ParseError::empty);
+
+    if constexpr (std::is_integral_v<T>) {
+        return detail::parse_integer<T>(text);
+    } else {
+#ifdef __cpp_lib_to_chars
+        return detail::parse_from_chars<T>(text);
+#else
+        static_assert(!sizeof(T), "parse<T> for floating point types needs std::from_chars.");
+#endif
+    }
+}
+
+// =================================================================================================
+// parse_column<T>
+// =================================================================================================
+
+// Words of the failure bitmap parse_column needs for `capacity` fields.
+[[nodiscard]] constexpr std::size_t failure_bitmap_words(std::size_t capacity) noexcept {
+    return (capacity + 63) / 64;
+}
+
+// Parses the `delimiter`-separated fields of `column` in one pass. Field i goes to out[i], or T{}
+// if it does not parse, in which case bit i % 64 of failures[i / 64] is set; every bitmap word
+// covering a field is overwritten. A trailing delimiter does not start another field. Returns the
+// number of fields, or out_of_range once more than `capacity` fields are found, after filling the
+// first `capacity` of them.
+template <typename T>
+[[nodiscard]] Result<std::size_t, ParseError> parse_column(std::string_view column, char delimiter,
+                                                           T *out, std::uint64_t *failures,
+                                                           std::size_t capacity) noexcept {
+    std::size_t   count = 0;
+    std::uint64_t word = 0;
+    bool          overflow = false;
+
+    while (!column.empty()) {
+        if (count == capacity) {
+            overflow = true;
+            break;
+        }
+
+        // Fields are short: an inline scan beats a memchr call per field.
+        const char       *first = column.data();
+        const char       *last = std::find(first, first + column.size(), delimiter);
+        const std::size_t length = static_cast<std::size_t>(last - first);
+        auto              field = parse<T>(std::string_view(first, length));
+
+        word |= std::uint64_t{field.is_err()} << (count % 64);
+        out[count++] = std::move(field).unwrap_or(T{});
+
+        if (count % 64 == 0) {
+            failures[count / 64 - 1] = word;
+            word = 0;
+        }
+
+        if (length == column.size())
+            break;
+
+        column.remove_prefix(length + 1);
+    }
+
+    if (count % 64 != 0)
+        failures[count / 64] = word;
+
+    if (overflow)
+        return Err(ParseError::out_of_range);
+
+    return Ok(std::move(count));
+}
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_PARSE_HPP_
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_POSIX_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_POSIX_HPP_
+
+#if !__has_include(<unistd.h>)
+#    error "result/posix.hpp requires a POSIX system."
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if __has_include(<sys/epoll.h>)
+#    include <sys/epoll.h>
+#endif
+
+#include <cerrno>
+#include <cstddef>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+#include "fd.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Errno
+// =================================================================================================
+
+// An errno value as a 4-byte error code. A failed call never reports 0, which makes 0 the niche:
+// Result<void, Errno> is sizeof(int), and Result<std::size_t, Errno> (16 bytes, trivially
+// copyable) is returned in two registers. Compare against the <cerrno> macros with Errno{EAGAIN}.
+enum class Errno : int {};
+
+template <>
+struct niche_traits<Errno> : value_niche<Errno, Errno{}> {};
+
+namespace posix {
+
+// The calling thread's current errno.
+[[nodiscard]] inline Errno last_errno() noexcept { return static_cast<Errno>(errno); }
+
+namespace detail {
+
+// Repeats a call that fails with -1 and EINTR, i.e. one interrupted by a signal handler before it
+// did anything.
+template <typename Call>
+auto retry_on_eintr(Call call) noexcept {
+    auto ret = call();
+
+    while (ret == -1 && errno == EINTR)
+        ret = call();
+
+    return ret;
+}
+
+[[nodiscard]] inline Result<std::size_t, Errno> to_size(ssize_t ret) noexcept {
+    if (ret < 0)
+        return Err(last_errno());
+
+    return Ok(static_cast<std::size_t>(ret));
+}
+
+[[nodiscard]] inline Result<void, Errno> to_void(int ret) noexcept {
+    if (ret < 0)
+        return Err(last_errno());
+
+    return Ok();
+}
+
+}  // namespace detail
+
+// =================================================================================================
+// Files
+// =================================================================================================
+
+// The wrappers mirror their syscalls one to one: no allocation, no buffering, and EINTR is retried
+// wherever repeating the call is what the caller would do by hand. Short reads and writes are
+// returned as they are.
+
+[[nodiscard]] inline Result<Fd, Errno> openat(int dirfd, const char *path, int flags,
+                                              mode_t mode = 0) noexcept {
+    const int fd = detail::retry_on_eintr([&] { return ::openat(dirfd, path, flags, mode); });
+
+    if (fd < 0)
+        return Err(last_errno());
+
+    return Ok(Fd(fd));
+}
+
+[[nodiscard]] inline Result<Fd, Errno> open(const char *path, int flags, mode_t mode = 0) noexcept {
+    return openat(AT_FDCWD, path, flags, mode);
+}
+
+[[nodiscard]] inline Result<std::size_t, Errno> read(int fd, void *buf,
+                                                     std::size_t count) noexcept {
+    return detail::to_size(detail::retry_on_eintr([&] { return ::read(fd, buf, count); }));
+}
+
+[[nodiscard]] inline Result<std::size_t, Errno> write(int fd, const void *buf,
+                                                      std::size_t count) noexcept {
+    return detail::to_size(detail::retry_on_eintr([&] { return ::write(fd, buf, count); }));
+}
+
+[[nodiscard]] inline Result<std::size_t, Errno> pread(int fd, void *buf, std::size_t count,
+                                                      off_t offset) noexcept {
+    return detail::to_size(
+        detail::retry_on_eintr([&] { return ::pread(fd, buf, count, offset); }));
+}
+
+[[nodiscard]] inline Result<std::size_t, Errno> pwrite(int fd, const void *buf, std::size_t count,
+                                                       off_t offset) noexcept {
+    return detail::to_size(
+        detail::retry_on_eintr([&] { return ::pwrite(fd, buf, count, offset); }));
+}
+
+[[nodiscard]] inline Result<void, Errno> fsync(int fd) noexcept {
+    return detail::to_void(detail::retry_on_eintr([&] { return ::fsync(fd); }));
+}
+
+[[nodiscard]] inline Result<void, Errno> ftruncate(int fd, off_t length) noexcept {
+    return detail::to_void(detail::retry_on_eintr([&] { return ::ftruncate(fd, length); }));
+}
+
+[[nodiscard]] inline Result<off_t, Errno> lseek(int fd, off_t offset, int whence) noexcept {
+    off_t ret = ::lseek(fd, offset, whence);
+
+    if (ret < 0)
+        return Err(last_errno());
+
+    return Ok(std::move(ret));
+}
+
+[[nodiscard]] inline Result<struct stat, Errno> fstat(int fd) noexcept {
+    struct stat st {};
+
+    if (::fstat(fd, &st) < 0)
+        return Err(last_errno());
+
+    return Ok(std::move(st));
+}
+
+// =================================================================================================
+// Memory mappings
+// =================================================================================================
+
+// Result<void *, Errno> is pointer-sized: the error is encoded in the unused address range.
+[[nodiscard]] inline Result<void *, Errno> mmap(void *addr, std::size_t length, int prot, int flags,
+                                                int fd, off_t offset) noexcept {
+    void *ret = ::mmap(addr, length, prot, flags, fd, offset);
+
+    if (ret == MAP_FAILED)
+        return Err(last_errno());
+
+    return Ok(std::move(ret));
+}
+
+[[nodiscard]] inline Result<void, Errno> munmap(void *addr, std::size_t length) noexcept {
+    return detail::to_void(::munmap(addr, length));
+}
+
+[[nodiscard]] inline Result<void, Errno> msync(void *addr, std::size_t length, int flags) noexcept {
+    return detail::to_void(::msync(addr, length, flags));
+}
+
+[[nodiscard]] inline Result<void, Errno> madvise(void *addr, std::size_t length,
+                                                 int advice) noexcept {
+    return detail::to_void(::madvise(addr, length, advice));
+}
+
+// =================================================================================================
+// Event polling
+// =================================================================================================
+
+#if __has_include(<sys/epoll.h>)
+[[nodiscard]] inline Result<Fd, Errno> epoll_create1(int flags) noexcept {
+    const int fd = ::epoll_create1(flags);
+
+    if (fd < 0)
+        return Err(last_errno());
+
+    return Ok(Fd(fd));
+}
+
+[[nodiscard]] inline Result<void, Errno> epoll_ctl(int epfd, int op, int fd,
+                                                   epoll_event *event) noexcept {
+    return detail::to_void(::epoll_ctl(epfd, op, fd, event));
+}
+
+// Returns the number of ready events. An interrupted wait is restarted with the full timeout, so a
+// signal storm can stretch it; pass a short timeout and loop if that matters.
+[[nodiscard]] inline Result<std::size_t, Errno> epoll_wait(int epfd, epoll_event *events,
+                                                           int max_events, int timeout) noexcept {
+    const int ret =
+        detail::retry_on_eintr([&] { return ::epoll_wait(epfd, events, max_events, timeout); });
+
+    return detail::to_size(ret);
+}
+#endif
+
+}  // namespace posix
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_POSIX_HPP_
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_PTR_RESULT_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_PTR_RESULT_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// PtrResult<T, E>
+// =================================================================================================
+
+// Single-word counterpart of Result<std::unique_ptr<T>, E> for aligned heap objects. The word holds
+// either the owned pointer (low bit clear) or the error code shifted left by one with the low bit
+// set, so is_ok() is a single bit test and sizeof(PtrResult) == sizeof(T *). E is an enum or
+// integral type whose values fit into 63 bits (signed values are sign-extended on the way out).
+// Moved-from results are Ok(nullptr), like a moved-from unique_ptr.
+template <typename T, typename E>
+class [[nodiscard]] PtrResult {
+    static_assert(!std::is_array_v<T>, "PtrResult<T[], E> is not supported.");
+    static_assert(alignof(T) >= 2, "PtrResult needs the low pointer bit of T * to be free.");
+    static_assert(std::is_enum_v<E> || std::is_integral_v<E>,
+                  "PtrResult error codes must be enums or integers.");
+    static_assert(sizeof(E) <= sizeof(std::uintptr_t));
+
+    static constexpr std::uintptr_t err_tag = 1;
+
+    using err_repr = std::conditional_t<std::is_enum_v<E>, std::underlying_type<E>,
+                                        std::common_type<E>>;
+    using err_int = typename err_repr::type;
+
+    static std::uintptr_t encode(E e) noexcept {
+        return (static_cast<std::uintptr_t>(static_cast<err_int>(e)) << 1) | err_tag;
+    }
+
+    static E decode(std::uintptr_t word) noexcept {
+        if constexpr (std::is_signed_v<err_int>) {
+            return static_cast<E>(static_cast<err_int>(static_cast<std::intptr_t>(word) >> 1));
+        } else {
+            return static_cast<E>(static_cast<err_int>(word >> 1));
+        }
+    }
+
+    [[nodiscard]] T *pointer() const noexcept { return reinterpret_cast<T *>(m_word); }
+
+    [[nodiscard]] T *release_ok() noexcept {
+        return reinterpret_cast<T *>(std::exchange(m_word, 0));
+    }
+
+   public:
+    using ok_type [[maybe_unused]] = std::unique_ptr<T>;
+    using err_type [[maybe_unused]] = E;
+
+    PtrResult(wrapper::Ok<std::unique_ptr<T>> ok) noexcept
+        : m_word(reinterpret_cast<std::uintptr_t>(ok.value.release())) {}
+
+    PtrResult(wrapper::Err<E> err) noexcept : m_word(encode(err.value)) {
+        RESULT_USDT_PROBE0(result, err);
+        assert(decode(m_word) == err.value && "Error code does not fit into 63 bits.");
+    }
+
+    PtrResult(const PtrResult &) = delete;
+
+    PtrResult(PtrResult &&other) noexcept : m_word(std::exchange(other.m_word, 0)) {}
+
+    PtrResult &operator=(const PtrResult &) = delete;
+
+    PtrResult &operator=(PtrResult &&other) noexcept {
+        PtrResult(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~PtrResult() {
+        if (is_ok())
+            std::default_delete<T>()(pointer());
+    }
+
+    void swap(PtrResult &other) noexcept { std::swap(m_word, other.m_word); }
+
+    // =============================================================================================
+    // member functions
+    // =============================================================================================
+
+    [[nodiscard]] bool is_ok() const noexcept { return (m_word & err_tag) == 0; }
+
+    [[nodiscard]] bool is_err() const noexcept { return (m_word & err_tag) != 0; }
+
+    // The owned pointer, or nullptr for an error.
+    [[nodiscard]] T *get() const noexcept { return is_ok() ? pointer() : nullptr; }
+
+    [[maybe_unused]] T &unwrap_ref() const {
+        if (!is_ok())
+            detail::expect_failed("Tried to unwrap_ref a result containing an error");
+
+        return *pointer();
+    }
+
+    [[maybe_unused]] std::unique_ptr<T> unwrap() && {
+        if (!is_ok())
+            detail::expect_failed("Tried to unwrap a result containing an error");
+
+        return std::unique_ptr<T>(release_ok());
+    }
+
+    [[maybe_unused]] std::unique_ptr<T> unwrap_unchecked() && {
+        return std::unique_ptr<T>(release_ok());
+    }
+
+    // Consumes the result like Result::unwrap_err(). The error is decoded from the tagged word, so
+    // there is no unwrap_err_ref().
+    [[maybe_unused]] E unwrap_err() && {
+        if (!is_err())
+            detail::expect_failed("Tried to unwrap an error containing a result");
+
+        return decode(m_word);
+    }
+
+    [[maybe_unused]] E unwrap_err_unchecked() && noexcept { return decode(m_word); }
+
+    [[maybe_unused]] std::unique_ptr<T> unwrap_or(std::unique_ptr<T> other) && {
+        return is_ok() ? std::unique_ptr<T>(release_ok()) : std::move(other);
+    }
+
+    // Converts into the general Result, e.g. to use the functional chaining.
+    [[maybe_unused]] Result<std::unique_ptr<T>, E> into_result() && {
+        if (is_ok())
+            return Ok(std::unique_ptr<T>(release_ok()));
+
+        return Err(decode(m_word));
+    }
+
+   private:
+    std::uintptr_t m_word;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_PTR_RESULT_HPP_
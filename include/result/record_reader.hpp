@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_RECORD_READER_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_RECORD_READER_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+#include "posix.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// ReadError
+// =================================================================================================
+
+// Negative values are conditions of the reader itself; positive values are the errno of a failed
+// read(), e.g. ReadError{EIO}.
+enum class ReadError : int {
+    end_of_stream = -1,    // every record has been returned
+    record_too_long = -2,  // a record did not fit into the buffer and was skipped
+};
+
+[[nodiscard]] inline ReadError read_error(Errno e) noexcept { return static_cast<ReadError>(e); }
+
+[[nodiscard]] inline bool is_errno(ReadError e) noexcept { return static_cast<int>(e) > 0; }
+
+// =================================================================================================
+// RecordReader
+// =================================================================================================
+
+// Pull-based reader of delimiter-separated records, by default lines. next() returns a view of the
+// record without its delimiter; the view stays valid until the following call. A last record
+// without a trailing delimiter is still returned, after which every call yields end_of_stream.
+//
+// Over a descriptor, records are cut out of one buffer allocated at construction. Once no complete
+// record is left, the partial one is moved to the front with a single memmove and one read() fills
+// all the space behind it. No per-record allocation or copy takes place. A record that does not
+// fit into the buffer yields record_too_long once and is skipped up to its delimiter.
+//
+// Over a memory region, e.g. MappedFile::view(), records are views into the region itself.
+class RecordReader {
+   public:
+    static constexpr std::size_t default_buffer_size = std::size_t{256} * 1024;
+
+    // Reads from `fd`, which the caller keeps owning.
+    explicit RecordReader(int fd, char delimiter = '\n',
+                          std::size_t buffer_size = default_buffer_size)
+        : m_buffer(new char[buffer_size]),
+          m_data(m_buffer.get()),
+          m_capacity(buffer_size),
+          m_fd(fd),
+          m_delimiter(delimiter) {}
+
+    explicit RecordReader(std::string_view region, char delimiter = '\n') noexcept
+        : m_data(region.data()),
+          m_end(region.size()),
+          m_capacity(region.size()),
+          m_delimiter(delimiter),
+          m_eof(true) {}
+
+    [[nodiscard]] Result<std::string_view, ReadError> next() noexcept {
+        for (;;) {
+            const char       *first = m_data + m_begin;
+            const std::size_t unscanned = m_end - m_begin - m_scanned;
+            const char       *found =
+                unscanned == 0 ? nullptr
+                               : static_cast<const char *>(
+                                     std::memchr(first + m_scanned, m_delimiter, unscanned));
+
+            if (found) {
+                const auto length = static_cast<std::size_t>(found - first);
+                m_begin += length + 1;
+                m_scanned = 0;
+
+                if (std::exchange(m_skipping, false))
+                    continue;
+
+                return Ok(std::string_view(first, length));
+            }
+
+            const std::size_t rest = m_end - m_begin;
+
+            if (m_eof) {
+                m_begin = m_end;
+                m_scanned = 0;
+
+                if (rest == 0 || std::exchange(m_skipping, false))
+                    return Err(ReadError::end_of_stream);
+
+                return Ok(std::string_view(first, rest));
+            }
+
+            m_scanned = rest;
+
+            if (m_scanned == m_capacity) {
+                // Nothing of the record is kept: the rest is dropped up to the next delimiter.
+                const bool reported = std::exchange(m_skipping, true);
+                m_begin = m_end = m_scanned = 0;
+
+                if (!reported)
+                    return Err(ReadError::record_too_long);
+            }
+
+            if (auto filled = refill(); filled.is_err())
+                return Err(read_error(filled.unwrap_err_ref()));
+        }
+    }
+
+   private:
+    Result<void, Errno> refill() noexcept {
+        if (m_begin != 0) {
+            std::memmove(m_buffer.get(), m_data + m_begin, m_end - m_begin);
+            m_end -= m_begin;
+            m_begin = 0;
+        }
+
+        auto got = posix::read(m_fd, m_buffer.get() + m_end, m_capacity - m_end);
+
+        if (got.is_err())
+            return Err(std::move(got).unwrap_err());
+
+        m_end += got.unwrap_ref();
+        m_eof = got.unwrap_ref() == 0;
+        return Ok();
+    }
+
+    std::unique_ptr<char[]> m_buffer;
+    const char             *m_data = nullptr;
+    std::size_t             m_begin = 0;
+    std::size_t             m_end = 0;
+    std::size_t             m_scanned = 0;  // bytes after m_begin known to hold no delimiter
+    std::size_t             m_capacity = 0;
+    int                     m_fd = -1;
+    char                    m_delimiter;
+    bool                    m_eof = false;
+    bool                    m_skipping = false;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_RECORD_READER_HPP_
@@ -0,0 +1,411 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_CACHE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_CACHE_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Policy and statistics
+// =================================================================================================
+
+// How long an outcome stays cached. A TTL of zero or less does not cache that outcome at all; by
+// default successes never expire and errors are not cached.
+template <typename E, typename Clock = std::chrono::steady_clock>
+struct ResultCachePolicy {
+    using duration = typename Clock::duration;
+
+    duration ok_ttl = duration::max();
+    duration err_ttl = duration::zero();
+
+    // Errors for which this returns false are transient, e.g. timeouts, and are never cached. An
+    // empty function caches every error for err_ttl. It is called without any shard lock held, so
+    // it may use the cache itself.
+    std::function<bool(const E &)> cache_err;
+};
+
+struct ResultCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;     // lookups that ran the computation
+    std::uint64_t coalesced = 0;  // lookups that waited for a computation already in flight
+    std::uint64_t evictions = 0;  // entries dropped to make room, expired ones included
+};
+
+// =================================================================================================
+// ResultCache<K, V, E>
+// =================================================================================================
+
+// Concurrent memoization of Result<V, E>-returning lookups.
+//
+// Keys are spread over a power-of-two number of shards, each with its own mutex, a fixed array of
+// slots and an index from key to slot. The Result is stored in place in its slot, so a cached
+// Result<V, E> costs its own size plus the key, the expiry and a reference bit; there is no
+// per-entry allocation besides the index node.
+//
+// A full shard first replaces an expired entry, if it has one. Otherwise it evicts with CLOCK: a
+// hit sets the reference bit of an entry, and the hand clears set bits until it finds an entry
+// without one to replace.
+//
+// get_or_compute() deduplicates concurrent misses: the first caller of a missing key runs the
+// computation without holding the shard lock, later callers of the same key wait for it and
+// receive a copy of its outcome, whether the policy caches that outcome or not.
+template <typename K, typename V, typename E, typename Hash = std::hash<K>,
+          typename Clock = std::chrono::steady_clock>
+class ResultCache {
+   public:
+    using result_type = Result<V, E>;
+    using policy_type = ResultCachePolicy<E, Clock>;
+    using time_point = typename Clock::time_point;
+
+    static constexpr std::size_t default_shards = 16;
+
+    // Holds at least `capacity` entries; `shards` is rounded up to a power of two.
+    explicit ResultCache(std::size_t capacity, policy_type policy = {},
+                         std::size_t shards = default_shards)
+        : m_policy(std::move(policy)) {
+        std::size_t count = 1;
+        while (count < shards)
+            count <<= 1;
+
+        m_shard_mask = count - 1;
+        m_shard_capacity = capacity / count + (capacity % count != 0);
+        if (m_shard_capacity == 0)
+            m_shard_capacity = 1;
+
+        m_shards = std::make_unique<shard[]>(count);
+        for (std::size_t i = 0; i < count; ++i)
+            m_shards[i].slots.reserve(m_shard_capacity);
+    }
+
+    ResultCache(const ResultCache &) = delete;
+    ResultCache &operator=(const ResultCache &) = delete;
+
+    // Returns the cached outcome for `key`, or the outcome of fn(key), which is cached according
+    // to the policy. If fn throws, the exception propagates to this caller and the waiters retry.
+    template <typename Fn>
+    result_type get_or_compute(const K &key, Fn &&fn) {
+        shard                       &s = shard_for(key);
+        std::unique_lock<std::mutex> lock(s.mutex);
+
+        for (;;) {
+            if (const entry *hit = s.find_fresh(key, Clock::now())) {
+                ++s.stats.hits;
+                return hit->value;
+            }
+
+            auto pending = s.flights.find(key);
+            if (pending == s.flights.end())
+                break;
+
+            const std::shared_ptr<flight> waiting = pending->second;
+            ++s.stats.coalesced;
+            s.landed.wait(lock, [&waiting] { return waiting->done; });
+
+            if (waiting->value)
+                return *waiting->value;
+        }
+
+        ++s.stats.misses;
+        const auto leading = std::make_shared<flight>();
+        s.flights.emplace(key, leading);
+        lock.unlock();
+
+        std::optional<result_type> value;
+
+        try {
+            value.emplace(std::invoke(std::forward<Fn>(fn), key));
+        } catch (...) {
+            land(s, key, leading, std::nullopt);
+            throw;
+        }
+
+        land(s, key, leading, value);
+        return std::move(*value);
+    }
+
+    // The cached outcome for `key`, if there is one that has not expired.
+    [[nodiscard]] std::optional<result_type> find(const K &key) {
+        shard                      &s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        if (const entry *hit = s.find_fresh(key, Clock::now())) {
+            ++s.stats.hits;
+            return hit->value;
+        }
+
+        return std::nullopt;
+    }
+
+    // Caches `value` for `key` as if a computation had returned it.
+    void insert(const K &key, result_type value) {
+        const time_point now = Clock::now();
+        const auto       expires = expiry(value, now);
+
+        if (!expires)
+            return;
+
+        shard                      &s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        store(s, key, std::move(value), *expires, now);
+    }
+
+    bool erase(const K &key) {
+        shard                      &s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        auto found = s.index.find(key);
+        if (found == s.index.end())
+            return false;
+
+        s.release(found);
+        return true;
+    }
+
+    void clear() {
+        for (std::size_t i = 0; i <= m_shard_mask; ++i) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+
+            m_shards[i].index.clear();
+            m_shards[i].slots.clear();
+            m_shards[i].free.clear();
+            m_shards[i].hand = 0;
+            m_shards[i].soonest = time_point::max();
+        }
+    }
+
+    // Entries held, including expired ones not yet replaced.
+    [[nodiscard]] std::size_t size() const {
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i <= m_shard_mask; ++i) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            total += m_shards[i].index.size();
+        }
+
+        return total;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return m_shard_capacity * (m_shard_mask + 1);
+    }
+
+    [[nodiscard]] ResultCacheStats stats() const {
+        ResultCacheStats total;
+
+        for (std::size_t i = 0; i <= m_shard_mask; ++i) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            const ResultCacheStats     &stats = m_shards[i].stats;
+
+            total.hits += stats.hits;
+            total.misses += stats.misses;
+            total.coalesced += stats.coalesced;
+            total.evictions += stats.evictions;
+        }
+
+        return total;
+    }
+
+   private:
+    struct entry {
+        K           key;
+        result_type value;
+        time_point  expires;
+        bool        referenced;
+    };
+
+    // A computation in flight. Waiters keep it alive through the shared_ptr after it has left
+    // the shard; value stays empty if the computation threw.
+    struct flight {
+        bool                       done = false;
+        std::optional<result_type> value;
+    };
+
+    using index_type = std::unordered_map<K, std::size_t, Hash>;
+    using flight_map = std::unordered_map<K, std::shared_ptr<flight>, Hash>;
+
+    // Aligned so that shards next to each other do not share a cache line.
+    struct alignas(64) shard {
+        std::mutex                        mutex;
+        std::condition_variable           landed;
+        index_type                        index;
+        std::vector<std::optional<entry>> slots;
+        std::vector<std::size_t>          free;
+        std::size_t                       hand = 0;
+        time_point                        soonest = time_point::max();  // no entry expires earlier
+        flight_map                        flights;
+        ResultCacheStats                  stats;
+
+        const entry *find_fresh(const K &key, time_point now) {
+            auto found = index.find(key);
+            if (found == index.end())
+                return nullptr;
+
+            entry &e = *slots[found->second];
+            if (e.expires <= now) {
+                release(found);
+                return nullptr;
+            }
+
+            e.referenced = true;
+            return &e;
+        }
+
+        void release(typename index_type::iterator found) {
+            slots[found->second].reset();
+            free.push_back(found->second);
+            index.erase(found);
+        }
+    };
+
+    shard &shard_for(const K &key) const {
+        // Fibonacci hashing spreads keys over the shards even where std::hash is the identity, as
+        // it is for integers.
+        const auto hash = static_cast<std::uint64_t>(Hash{}(key)) * 0x9e3779b97f4a7c15;
+        return m_shards[static_cast<std::size_t>(hash >> 32) & m_shard_mask];
+    }
+
+    // Expiry of a fresh outcome, or nullopt if the policy does not cache it. Runs the policy's
+    // cache_err, so callers must not hold a shard lock.
+    std::optional<time_point> expiry(const result_type &value, time_point now) const {
+        typename Clock::duration ttl = m_policy.ok_ttl;
+
+        if (value.is_err()) {
+            ttl = m_policy.err_ttl;
+
+            if (m_policy.cache_err && !m_policy.cache_err(value.unwrap_err_ref()))
+                return std::nullopt;
+        }
+
+        if (ttl <= Clock::duration::zero())
+            return std::nullopt;
+
+        if (ttl > time_point::max() - now)
+            return time_point::max();
+
+        return now + ttl;
+    }
+
+    void store(shard &s, const K &key, result_type value, time_point expires, time_point now) {
+        if (expires < s.soonest)
+            s.soonest = expires;
+
+        if (auto found = s.index.find(key); found != s.index.end()) {
+            entry &e = *s.slots[found->second];
+            e.value = std::move(value);
+            e.expires = expires;
+            return;
+        }
+
+        const std::size_t slot = acquire(s, now);
+        s.slots[slot].emplace(entry{key, std::move(value), expires, false});
+        s.index.emplace(key, slot);
+    }
+
+    // A free slot, after evicting with the CLOCK hand if the shard is full.
+    std::size_t acquire(shard &s, time_point now) {
+        if (!s.free.empty()) {
+            const std::size_t slot = s.free.back();
+            s.free.pop_back();
+            return slot;
+        }
+
+        if (s.slots.size() < m_shard_capacity) {
+            s.slots.emplace_back();
+            return s.slots.size() - 1;
+        }
+
+        // `soonest` is a lower bound of the expiries in the shard, so the scan only runs when some
+        // entry may have expired. A scan that finds none tightens the bound.
+        if (s.soonest <= now) {
+            time_point soonest = time_point::max();
+
+            for (std::size_t i = 0; i < m_shard_capacity; ++i) {
+                const std::size_t slot = (s.hand + i) % m_shard_capacity;
+                const time_point  expires = s.slots[slot]->expires;
+
+                if (expires <= now)
+                    return evict(s, slot);
+
+                if (expires < soonest)
+                    soonest = expires;
+            }
+
+            s.soonest = soonest;
+        }
+
+        for (;;) {
+            const std::size_t slot = s.hand;
+            s.hand = (s.hand + 1) % m_shard_capacity;
+
+            entry &e = *s.slots[slot];
+            if (e.referenced) {
+                e.referenced = false;
+                continue;
+            }
+
+            return evict(s, slot);
+        }
+    }
+
+    std::size_t evict(shard &s, std::size_t slot) {
+        s.index.erase(s.slots[slot]->key);
+        s.slots[slot].reset();
+        ++s.stats.evictions;
+        return slot;
+    }
+
+    // Ends the flight of `key`. The outcome is copied for the waiters only if there are any.
+    void land(shard &s, const K &key, const std::shared_ptr<flight> &leading,
+              const std::optional<result_type> &value) {
+        const time_point now = Clock::now();
+        const auto       expires = value ? expiry(*value, now) : std::nullopt;
+
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.flights.erase(key);
+
+            if (expires)
+                store(s, key, *value, *expires, now);
+
+            if (leading.use_count() > 1)
+                leading->value = value;
+
+            leading->done = true;
+        }
+
+        s.landed.notify_all();
+    }
+
+    policy_type              m_policy;
+    std::unique_ptr<shard[]> m_shards;
+    std::size_t              m_shard_mask = 0;
+    std::size_t              m_shard_capacity = 0;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_CACHE_HPP_
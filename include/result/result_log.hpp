@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_LOG_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_LOG_HPP_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+#include "fd.hpp"
+#include "posix.hpp"
+#include "serialize.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+namespace detail {
+
+// Writers for serializer<T>: the first pass measures a record, the second writes it in place.
+struct log_size_counter {
+    std::size_t size = 0;
+
+    void write(const void *, std::size_t n) noexcept { size += n; }
+};
+
+struct log_place_writer {
+    std::byte *next;
+
+    void write(const void *data, std::size_t n) noexcept {
+        std::memcpy(next, data, n);
+        next += n;
+    }
+};
+
+// FNV-1a over the record size and payload. 0 marks an uncommitted record, so it maps to 1.
+[[nodiscard]] inline std::uint32_t log_checksum(const std::byte *payload,
+                                                std::uint32_t    size) noexcept {
+    std::uint32_t hash = 2166136261u;
+
+    const auto mix = [&hash](std::uint8_t byte) {
+        hash ^= byte;
+        hash *= 16777619u;
+    };
+
+    for (int shift = 0; shift < 32; shift += 8)
+        mix(static_cast<std::uint8_t>(size >> shift));
+
+    for (std::uint32_t i = 0; i < size; ++i)
+        mix(static_cast<std::uint8_t>(payload[i]));
+
+    return hash == 0 ? 1 : hash;
+}
+
+}  // namespace detail
+
+// =================================================================================================
+// ResultLog<T, E>
+// =================================================================================================
+
+// Append-only log of serialized Result<T, E> in a memory-mapped segment file of fixed capacity,
+// e.g. the outcome of every item of a batch job so that a restart can skip finished work.
+//
+// Layout: a 64-byte header (magic, reservation cursor) followed by 8-byte aligned records
+//
+//     std::uint32_t size;    // payload bytes, stored by the reservation itself
+//     std::uint32_t commit;  // checksum of size and payload, written last; 0 while in flight
+//     payload;               // serialize(Result<T, E>), see serialize.hpp
+//
+// append() is safe to call from any number of threads and never waits for another writer. A
+// writer reserves a record by a compare-and-swap of its size into the zero size word at the
+// cursor, and only then moves the cursor in the mapped header past it; a writer that loses the
+// race moves the cursor past the winner's record and tries again. The cursor therefore never
+// passes a record without a size. A full segment fails with ENOSPC.
+//
+// open() recovers an existing segment by scanning its records. A record with a size but a missing
+// or wrong commit was torn by a crash; it is counted and for_each() skips it, and the records
+// behind it are kept. The scan ends at the first zero size, and everything behind it is zeroed so
+// that the next appends start from a clean tail. Recovery assumes no other process has the
+// segment open.
+//
+// The log survives a crash of the process once append() returns; sync() additionally flushes it
+// to the storage device.
+template <typename T, typename E>
+class ResultLog {
+    static constexpr char        magic[8] = {'R', 'E', 'S', 'L', 'O', 'G', '0', '1'};
+    static constexpr std::size_t cursor_offset = sizeof(magic);
+    static constexpr std::size_t data_offset = 64;
+    static constexpr std::size_t record_header = 2 * sizeof(std::uint32_t);
+
+   public:
+    using result_type = Result<T, E>;
+
+    // A committed record, viewed in place in the mapping.
+    struct Entry {
+        std::size_t      offset;  // of the record in the segment file
+        std::string_view bytes;   // serialized payload
+
+        [[nodiscard]] Result<result_type, SerializeError> read() const {
+            BufferReader in(bytes.data(), bytes.size());
+            return serializer<result_type>::read(in);
+        }
+    };
+
+    // Opens the segment at `path`, or creates it with `capacity` bytes. An existing segment keeps
+    // its size. Capacities are rounded down to a multiple of 8.
+    [[nodiscard]] static Result<ResultLog, Errno> open(const char *path, std::size_t capacity) {
+        auto opened = posix::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (opened.is_err())
+            return Err(std::move(opened).unwrap_err());
+
+        const Fd fd = std::move(opened).unwrap();
+
+        auto st = posix::fstat(fd.get());
+        if (st.is_err())
+            return Err(std::move(st).unwrap_err());
+
+        const auto size = static_cast<std::size_t>(st.unwrap_ref().st_size);
+        const bool created = size == 0;
+
+        capacity = align_down(created ? capacity : size);
+
+        if (created) {
+            if (capacity <= data_offset)
+                return Err(Errno{EINVAL});
+
+            if (auto grown = posix::ftruncate(fd.get(), static_cast<off_t>(capacity));
+                grown.is_err())
+                return Err(std::move(grown).unwrap_err());
+        } else if (capacity <= data_offset) {
+            return Err(Errno{EINVAL});
+        }
+
+        auto mapped = posix::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd.get(),
+                                  0);
+        if (mapped.is_err())
+            return Err(std::move(mapped).unwrap_err());
+
+        ResultLog log(static_cast<std::byte *>(mapped.unwrap_ref()), capacity);
+
+        if (created) {
+            std::memcpy(log.m_base, magic, sizeof(magic));
+            log.store_cursor(data_offset);
+        } else if (std::memcmp(log.m_base, magic, sizeof(magic)) != 0) {
+            return Err(Errno{EINVAL});
+        } else {
+            log.recover();
+        }
+
+        return Ok(std::move(log));
+    }
+
+    ResultLog(const ResultLog &) = delete;
+    ResultLog &operator=(const ResultLog &) = delete;
+
+    ResultLog(ResultLog &&other) noexcept
+        : m_base(std::exchange(other.m_base, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)),
+          m_recovered(other.m_recovered),
+          m_torn(other.m_torn) {}
+
+    ResultLog &operator=(ResultLog &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            m_base = std::exchange(other.m_base, nullptr);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_recovered = other.m_recovered;
+            m_torn = other.m_torn;
+        }
+
+        return *this;
+    }
+
+    ~ResultLog() { unmap(); }
+
+    // Thread-safe. Serializes `result` straight into the mapping, without a staging buffer.
+    Result<void, Errno> append(const result_type &result) {
+        detail::log_size_counter counter;
+        serialize(result, counter);
+
+        if (counter.size > UINT32_MAX)
+            return Err(Errno{EMSGSIZE});
+
+        // Every serialized Result has at least its tag byte, so a reserved size is never zero.
+        const auto        size = static_cast<std::uint32_t>(counter.size);
+        const std::size_t total = record_header + align(size);
+        std::byte        *record = reserve(size, total);
+
+        if (!record)
+            return Err(Errno{ENOSPC});
+
+        detail::log_place_writer out{record + record_header};
+        serialize(result, out);
+
+        const std::uint32_t commit = detail::log_checksum(record + record_header, size);
+        __atomic_store_n(commit_word(record), commit, __ATOMIC_RELEASE);
+
+        return Ok();
+    }
+
+    // Calls fn(Entry) for each committed record, in log order, skipping torn ones. Stops at the
+    // first record still in flight. Returns the number of entries.
+    template <typename Fn>
+    std::size_t for_each(Fn &&fn) const {
+        std::size_t count = 0;
+
+        const auto visit = [&](std::size_t offset, const std::byte *payload, std::uint32_t size) {
+            fn(Entry{offset, std::string_view(reinterpret_cast<const char *>(payload), size)});
+            ++count;
+        };
+
+        scan(m_recovered, nullptr, visit);
+
+        return count;
+    }
+
+    // Flushes the mapping to the storage device.
+    Result<void, Errno> sync() const noexcept {
+        return posix::msync(m_base, m_capacity, MS_SYNC);
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+    // Bytes reserved so far, header included.
+    [[nodiscard]] std::size_t used() const noexcept {
+        const auto used = __atomic_load_n(cursor(), __ATOMIC_RELAXED);
+        return used < m_capacity ? static_cast<std::size_t>(used) : m_capacity;
+    }
+
+    // Torn records skipped by the recovery in open().
+    [[nodiscard]] std::size_t torn_records() const noexcept { return m_torn; }
+
+   private:
+    ResultLog(std::byte *base, std::size_t capacity) noexcept
+        : m_base(base), m_capacity(capacity) {}
+
+    static constexpr std::size_t align(std::size_t n) noexcept { return align_down(n + 7); }
+
+    static constexpr std::size_t align_down(std::size_t n) noexcept { return n & ~std::size_t{7}; }
+
+    static std::uint32_t *size_word(std::byte *record) noexcept {
+        return reinterpret_cast<std::uint32_t *>(record);
+    }
+
+    static std::uint32_t *commit_word(std::byte *record) noexcept {
+        return reinterpret_cast<std::uint32_t *>(record + sizeof(std::uint32_t));
+    }
+
+    std::uint64_t *cursor() const noexcept {
+        return reinterpret_cast<std::uint64_t *>(m_base + cursor_offset);
+    }
+
+    void store_cursor(std::size_t offset) noexcept {
+        __atomic_store_n(cursor(), std::uint64_t{offset}, __ATOMIC_RELEASE);
+    }
+
+    // Claims the record at the cursor by storing its size, then moves the cursor past it. Returns
+    // the record, or nullptr if it does not fit in the rest of the segment.
+    std::byte *reserve(std::uint32_t size, std::size_t total) noexcept {
+        for (;;) {
+            std::uint64_t offset = __atomic_load_n(cursor(), __ATOMIC_ACQUIRE);
+
+            if (total > m_capacity - offset)
+                return nullptr;
+
+            std::byte    *record = m_base + offset;
+            std::uint32_t claimed = 0;
+
+            if (__atomic_compare_exchange_n(size_word(record), &claimed, size, false,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                advance_cursor(offset, total);
+                return record;
+            }
+
+            // Another writer claimed this record but may not have moved the cursor yet.
+            advance_cursor(offset, record_header + align(claimed));
+        }
+    }
+
+    // Moves the cursor from `offset` past a record of `total` bytes, unless another writer
+    // already did.
+    void advance_cursor(std::uint64_t offset, std::size_t total) noexcept {
+        __atomic_compare_exchange_n(cursor(), &offset, offset + total, false, __ATOMIC_RELEASE,
+                                    __ATOMIC_RELAXED);
+    }
+
+    // Walks the records from the start. fn(offset, payload, size) sees every committed one. Records
+    // with a size but no valid commit are torn if they start before `settled`, and passed over and
+    // counted in *torn, if given; later ones are in flight and end the walk. Returns the offset
+    // behind the last record walked.
+    template <typename Fn>
+    std::size_t scan(std::size_t settled, std::size_t *torn, Fn &&fn) const {
+        std::size_t offset = data_offset;
+
+        while (record_header <= m_capacity - offset) {
+            std::byte          *record = m_base + offset;
+            const std::uint32_t commit = __atomic_load_n(commit_word(record), __ATOMIC_ACQUIRE);
+            const std::uint32_t size = __atomic_load_n(size_word(record), __ATOMIC_RELAXED);
+            const std::size_t   total = record_header + align(size);
+
+            if (size == 0 || total > m_capacity - offset)
+                break;
+
+            const std::byte *payload = record + record_header;
+
+            if (commit != 0 && commit == detail::log_checksum(payload, size))
+                fn(offset, payload, size);
+            else if (offset >= settled)
+                break;
+            else if (torn)
+                ++*torn;
+
+            offset += total;
+        }
+
+        return offset;
+    }
+
+    void recover() noexcept {
+        m_torn = 0;
+        m_recovered =
+            scan(m_capacity, &m_torn, [](std::size_t, const std::byte *, std::uint32_t) {});
+
+        // Nothing valid lies behind the end, but a damaged segment may have garbage there; clear
+        // it so that reservations find zero size words. Pages that are already zero are only
+        // read, not dirtied.
+        for (std::size_t offset = m_recovered; offset < m_capacity;
+             offset += sizeof(std::uint64_t)) {
+            auto *word = reinterpret_cast<std::uint64_t *>(m_base + offset);
+
+            if (*word != 0)
+                *word = 0;
+        }
+
+        store_cursor(m_recovered);
+    }
+
+    void unmap() noexcept {
+        if (m_base)
+            ::munmap(m_base, m_capacity);
+    }
+
+    std::byte  *m_base = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_recovered = data_offset;  // end of the records recovery found
+    std::size_t m_torn = 0;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_RESULT_LOG_HPP_
@@ -0,0 +1,392 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_RETRY_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_RETRY_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#    include <coroutine>
+#    include <exception>
+#    define RESULT_RETRY_COROUTINES
+#endif
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#if __has_include(<unistd.h>)
+#    include "posix.hpp"
+#endif
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// retry_traits<E>
+// =================================================================================================
+
+// Classifies errors as transient, i.e. worth another attempt. Every error is retryable unless the
+// error type specializes this:
+//
+//     template <> struct retry_traits<DbError> {
+//         static bool is_retryable(DbError e) noexcept { return e == DbError::deadlock; }
+//     };
+template <typename E>
+struct retry_traits {
+    static constexpr bool is_retryable(const E &) noexcept { return true; }
+};
+
+#ifdef LRUSINGER_RESULT_INCLUDE_RESULT_POSIX_HPP_
+// Interrupted, would-block, busy, timed-out and connection-level failures.
+template <>
+struct retry_traits<Errno> {
+    static bool is_retryable(Errno e) noexcept {
+        switch (static_cast<int>(e)) {
+            case EINTR:
+            case EAGAIN:
+            case EBUSY:
+            case ETIMEDOUT:
+            case ECONNRESET:
+            case ECONNREFUSED:
+            case ECONNABORTED:
+            case ENOBUFS:
+                return true;
+            default:
+                return e == Errno{EWOULDBLOCK};
+        }
+    }
+};
+#endif
+
+// =================================================================================================
+// RetryBudget
+// =================================================================================================
+
+// Token bucket shared by all retries of a client, so that an outage cannot multiply the load by
+// the number of attempts: once `burst` retries are spent, one more is allowed per `refill`
+// interval, and retry() gives up with the last error instead of retrying.
+//
+// Implemented as GCRA: a single atomic holds the theoretical arrival time of the next token, and
+// try_acquire() is one compare-exchange. First attempts never take a token.
+template <typename Clock = std::chrono::steady_clock>
+class RetryBudget {
+   public:
+    RetryBudget(std::uint32_t burst, std::chrono::nanoseconds refill) noexcept
+        : m_interval(std::max<std::int64_t>(refill.count(), 1)),
+          m_tolerance(m_interval * static_cast<std::int64_t>(burst)) {}
+
+    RetryBudget(const RetryBudget &) = delete;
+    RetryBudget &operator=(const RetryBudget &) = delete;
+
+    // Takes a token, or returns false if the bucket is empty.
+    [[nodiscard]] bool try_acquire() noexcept {
+        const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     Clock::now().time_since_epoch())
+                                     .count();
+
+        std::int64_t arrival = m_arrival.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const std::int64_t next = std::max(arrival, now) + m_interval;
+
+            if (next - now > m_tolerance)
+                return false;
+
+            if (m_arrival.compare_exchange_weak(arrival, next, std::memory_order_relaxed))
+                return true;
+        }
+    }
+
+   private:
+    std::int64_t              m_interval;
+    std::int64_t              m_tolerance;
+    std::atomic<std::int64_t> m_arrival{std::numeric_limits<std::int64_t>::min() / 2};
+};
+
+// =================================================================================================
+// RetryPolicy
+// =================================================================================================
+
+template <typename Clock = std::chrono::steady_clock>
+struct RetryPolicy {
+    std::uint32_t max_attempts = 4;  // including the first one
+
+    // Decorrelated jitter: each delay is drawn uniformly from [base_delay, 3 * previous delay] and
+    // capped at max_delay, so that clients that failed together do not retry together.
+    std::chrono::nanoseconds base_delay = std::chrono::milliseconds(10);
+    std::chrono::nanoseconds max_delay = std::chrono::seconds(1);
+
+    // No retry is started that would sleep past this much time after the first attempt.
+    std::chrono::nanoseconds max_elapsed = std::chrono::nanoseconds::max();
+
+    RetryBudget<Clock> *budget = nullptr;  // shared between callers; null is unlimited
+
+    std::uint64_t seed = 0;  // of the jitter; 0 draws a fresh one per retry() call
+};
+
+namespace detail {
+
+[[nodiscard]] inline std::uint64_t retry_random(std::uint64_t &state) noexcept {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+[[nodiscard]] inline std::uint64_t retry_seed() noexcept {
+    thread_local std::uint64_t state =
+        reinterpret_cast<std::uintptr_t>(&state) ^
+        static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+
+    return retry_random(state);
+}
+
+template <typename R>
+[[nodiscard]] bool is_retryable_err(const R &result) {
+    using E = typename destruct_result<R>::err_type;
+
+    if constexpr (std::is_void_v<E>)
+        return true;
+    else
+        return retry_traits<std::remove_cv_t<std::remove_reference_t<E>>>::is_retryable(
+            result.unwrap_err_ref());
+}
+
+// The state of one retry() call: attempts made, the previous delay and the jitter generator.
+template <typename Clock>
+class retry_schedule {
+   public:
+    explicit retry_schedule(const RetryPolicy<Clock> &policy)
+        : m_policy(&policy),
+          m_start(Clock::now()),
+          m_delay(std::min(policy.base_delay, policy.max_delay)),
+          m_state(policy.seed != 0 ? policy.seed : retry_seed()) {}
+
+    // The delay before the next attempt after a retryable failure, or nullopt to give up.
+    [[nodiscard]] std::optional<std::chrono::nanoseconds> next() {
+        if (++m_attempts >= m_policy->max_attempts)
+            return std::nullopt;
+
+        const std::chrono::nanoseconds delay = jitter();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - m_start);
+
+        if (delay > m_policy->max_elapsed - std::min(elapsed, m_policy->max_elapsed))
+            return std::nullopt;
+
+        if (m_policy->budget && !m_policy->budget->try_acquire())
+            return std::nullopt;
+
+        return delay;
+    }
+
+   private:
+    std::chrono::nanoseconds jitter() noexcept {
+        using rep = std::chrono::nanoseconds::rep;
+
+        const rep low = std::min(m_policy->base_delay, m_policy->max_delay).count();
+        const rep previous = m_delay.count();
+        const rep high = std::min<rep>(previous > std::numeric_limits<rep>::max() / 3
+                                           ? std::numeric_limits<rep>::max()
+                                           : previous * 3,
+                                       m_policy->max_delay.count());
+
+        const auto span = static_cast<std::uint64_t>(high - low);
+        const auto offset = span == std::numeric_limits<std::uint64_t>::max()
+                                ? retry_random(m_state)
+                                : retry_random(m_state) % (span + 1);
+
+        m_delay = std::chrono::nanoseconds(low + static_cast<rep>(offset));
+        return m_delay;
+    }
+
+    const RetryPolicy<Clock>  *m_policy;
+    typename Clock::time_point m_start;
+    std::chrono::nanoseconds   m_delay;
+    std::uint64_t              m_state;
+    std::uint32_t              m_attempts = 0;
+};
+
+}  // namespace detail
+
+// =================================================================================================
+// retry
+// =================================================================================================
+
+// Blocks the calling thread between attempts.
+struct ThreadSleep {
+    void operator()(std::chrono::nanoseconds delay) const { std::this_thread::sleep_for(delay); }
+};
+
+// Calls fn() until it returns Ok, an error that retry_traits does not classify as retryable, or
+// the policy gives up: after max_attempts, past max_elapsed, or when the budget is empty. Returns
+// the last outcome. Between attempts, sleep(delay) is called; tests pass one that advances a
+// fake Clock instead.
+template <typename Clock, typename Fn, typename Sleep = ThreadSleep>
+auto retry(const RetryPolicy<Clock> &policy, Fn &&fn, Sleep &&sleep = {})
+    -> std::invoke_result_t<Fn &> {
+    using R = std::invoke_result_t<Fn &>;
+    static_assert(detail::is_result<R>::value, "retry() callable must return a Result.");
+
+    detail::retry_schedule<Clock> schedule(policy);
+
+    for (;;) {
+        R result = std::invoke(fn);
+
+        if (result.is_ok() || !detail::is_retryable_err(result))
+            return result;
+
+        const auto delay = schedule.next();
+        if (!delay)
+            return result;
+
+        std::invoke(sleep, *delay);
+    }
+}
+
+#ifdef RESULT_RETRY_COROUTINES
+// =================================================================================================
+// RetryTask and async_retry
+// =================================================================================================
+
+// Lazy coroutine returned by async_retry(). It starts when awaited and resumes its awaiter when
+// done; co_await yields R.
+template <typename R>
+class [[nodiscard]] RetryTask {
+   public:
+    struct promise_type {
+        std::optional<R>        value;
+        std::exception_ptr      exception;
+        std::coroutine_handle<> continuation;
+
+        RetryTask get_return_object() noexcept {
+            return RetryTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        auto final_suspend() noexcept {
+            struct resume_awaiter {
+                bool await_ready() noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> self) noexcept {
+                    if (self.promise().continuation)
+                        return self.promise().continuation;
+
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}
+            };
+
+            return resume_awaiter{};
+        }
+
+        void return_value(R result) { value.emplace(std::move(result)); }
+
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    RetryTask(RetryTask &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+    RetryTask &operator=(RetryTask &&other) noexcept {
+        if (this != &other) {
+            if (m_handle)
+                m_handle.destroy();
+
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~RetryTask() {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        m_handle.promise().continuation = awaiting;
+        return m_handle;
+    }
+
+    R await_resume() {
+        promise_type &promise = m_handle.promise();
+
+        if (promise.exception)
+            std::rethrow_exception(promise.exception);
+
+        return std::move(*promise.value);
+    }
+
+   private:
+    explicit RetryTask(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace detail {
+
+// The awaiter co_await gets from A: its member operator co_await, or A itself.
+template <typename A>
+auto retry_awaiter(A &&awaitable, int) -> decltype(std::forward<A>(awaitable).operator co_await());
+
+template <typename A>
+A &&retry_awaiter(A &&awaitable, long);
+
+template <typename A>
+using retry_await_result_t = decltype(retry_awaiter(std::declval<A>(), 0).await_resume());
+
+}  // namespace detail
+
+// Coroutine variant of retry(): fn() returns an awaitable yielding the Result, e.g. a RetryTask or
+// a UringOp, and sleep(delay) returns an awaitable that resumes after the delay, e.g. a timer of
+// the caller's event loop. The policy is copied into the coroutine; its budget is still shared.
+template <typename Clock, typename Fn, typename Sleep>
+auto async_retry(RetryPolicy<Clock> policy, Fn fn, Sleep sleep)
+    -> RetryTask<detail::retry_await_result_t<std::invoke_result_t<Fn &>>> {
+    using R = detail::retry_await_result_t<std::invoke_result_t<Fn &>>;
+    static_assert(detail::is_result<R>::value, "async_retry() awaitable must yield a Result.");
+
+    detail::retry_schedule<Clock> schedule(policy);
+
+    for (;;) {
+        R result = co_await std::invoke(fn);
+
+        if (result.is_ok() || !detail::is_retryable_err(result))
+            co_return result;
+
+        const auto delay = schedule.next();
+        if (!delay)
+            co_return result;
+
+        co_await std::invoke(sleep, *delay);
+    }
+}
+#endif
+
+#undef RESULT_RETRY_COROUTINES
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_RETRY_HPP_
@@ -0,0 +1,317 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_SERIALIZE_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_SERIALIZE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Wire format
+// =================================================================================================
+
+// Binary encoding of Results for caches and local queues. Payloads are written in the native byte
+// order and layout, so both ends must share the ABI: the format is meant to cross process
+// boundaries, not machines.
+//
+//   - A Result whose state lives entirely in its payload, i.e. one that is niche-packed to the size
+//     of its larger side and whose sides are trivially copyable, is written as its sizeof(Result)
+//     bytes, without a tag. Result<void, Errno> takes 4 bytes and Result<T *, Enum> 8.
+//   - Any other Result is a 1-byte tag (0 = Ok, 1 = Err) followed by the serialized payload of the
+//     active side, or nothing for void.
+//   - Trivially copyable payloads are copied with memcpy; std::string is a 64-bit length followed
+//     by its characters. Other payloads need a serializer<T> specialization.
+//
+// Records carry no framing: a stream is a sequence of records written back to back, read until
+// the reader is empty (see deserialize_each).
+enum class SerializeError : std::uint8_t {
+    end_of_stream,  // the reader was empty before the record started
+    truncated,      // the reader ran out in the middle of a record
+    invalid_tag,    // a Result tag other than 0 or 1
+    invalid_size,   // a length prefix larger than the target can hold
+};
+
+// Writers provide `void write(const void *data, std::size_t size)` and readers provide
+// `bool read(void *data, std::size_t size)`, which fails without consuming anything when fewer
+// than size bytes are left, `bool empty() const` and `std::size_t remaining() const`. Length
+// prefixes are checked against remaining() before anything is allocated for them.
+//
+// Specialize serializer<T> for payloads that are not trivially copyable:
+//
+//     template <> struct serializer<Job> {
+//         template <typename Writer> static void write(const Job &job, Writer &out);
+//         template <typename Reader> static Result<Job, SerializeError> read(Reader &in);
+//     };
+template <typename T, typename Enable = void>
+struct serializer {};
+
+template <typename T>
+struct serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T> &&
+                                      std::is_default_constructible_v<T>>> {
+    template <typename Writer>
+    static void write(const T &value, Writer &out) {
+        out.write(std::addressof(value), sizeof(T));
+    }
+
+    template <typename Reader>
+    static Result<T, SerializeError> read(Reader &in) {
+        T value;
+
+        if (!in.read(std::addressof(value), sizeof(T)))
+            return Err(SerializeError::truncated);
+
+        return Ok(std::move(value));
+    }
+};
+
+template <typename CharT, typename Traits, typename Alloc>
+struct serializer<std::basic_string<CharT, Traits, Alloc>> {
+    using string = std::basic_string<CharT, Traits, Alloc>;
+
+    template <typename Writer>
+    static void write(const string &value, Writer &out) {
+        serializer<std::uint64_t>::write(value.size(), out);
+        out.write(value.data(), value.size() * sizeof(CharT));
+    }
+
+    template <typename Reader>
+    static Result<string, SerializeError> read(Reader &in) {
+        auto size = serializer<std::uint64_t>::read(in);
+        if (size.is_err())
+            return Err(std::move(size).unwrap_err());
+
+        string value;
+        if (size.unwrap_ref() > value.max_size())
+            return Err(SerializeError::invalid_size);
+
+        // A corrupt prefix must not turn into a huge allocation.
+        if (size.unwrap_ref() > in.remaining() / sizeof(CharT))
+            return Err(SerializeError::truncated);
+
+        value.resize(static_cast<std::size_t>(size.unwrap_ref()));
+
+        if (!in.read(value.data(), value.size() * sizeof(CharT)))
+            return Err(SerializeError::truncated);
+
+        return Ok(std::move(value));
+    }
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr std::size_t payload_size_v = sizeof(T);
+
+template <>
+inline constexpr std::size_t payload_size_v<void> = 0;
+
+}  // namespace detail
+
+template <typename T, typename E, auto OS, auto ES>
+struct serializer<Result<T, E, OS, ES>> {
+    static_assert(!std::is_reference_v<T> && !std::is_reference_v<E>,
+                  "Results holding references cannot be serialized.");
+
+    using result = Result<T, E, OS, ES>;
+
+    template <typename X>
+    static constexpr bool bitwise_side_v =
+        std::is_void_v<X> ||
+        (std::is_trivially_copyable_v<X> && std::is_default_constructible_v<X>);
+
+    // The bytes of such a Result are its whole state: there is no discriminant besides the niche.
+    static constexpr bool bitwise =
+        bitwise_side_v<T> && bitwise_side_v<E> &&
+        sizeof(result) == std::max(detail::payload_size_v<T>, detail::payload_size_v<E>);
+
+    static constexpr std::uint8_t ok_tag = 0;
+    static constexpr std::uint8_t err_tag = 1;
+
+    template <typename Writer>
+    static void write(const result &value, Writer &out) {
+        if constexpr (bitwise) {
+            out.write(static_cast<const void *>(std::addressof(value)), sizeof(result));
+        } else if (value.is_ok()) {
+            out.write(&ok_tag, 1);
+
+            if constexpr (!std::is_void_v<T>)
+                serializer<T>::write(value.unwrap_ref(), out);
+        } else {
+            out.write(&err_tag, 1);
+
+            if constexpr (!std::is_void_v<E>)
+                serializer<E>::write(value.unwrap_err_ref(), out);
+        }
+    }
+
+    template <typename Reader>
+    static Result<result, SerializeError> read(Reader &in) {
+        if constexpr (bitwise) {
+            // Every byte pattern is either a T or the niche, so the bytes are taken over as they
+            // are, on top of a Result that holds no resources.
+            result value = placeholder();
+
+            if (!in.read(static_cast<void *>(std::addressof(value)), sizeof(result)))
+                return Err(SerializeError::truncated);
+
+            return Ok(std::move(value));
+        } else {
+            std::uint8_t tag;
+
+            if (!in.read(&tag, 1))
+                return Err(SerializeError::truncated);
+
+            if (tag == ok_tag)
+                return read_side<T, true>(in);
+
+            if (tag == err_tag)
+                return read_side<E, false>(in);
+
+            return Err(SerializeError::invalid_tag);
+        }
+    }
+
+   private:
+    static result placeholder() {
+        if constexpr (std::is_void_v<E>)
+            return result(Err());
+        else if constexpr (std::is_void_v<T>)
+            return result(Ok());
+        else
+            return result(Err(E{}));
+    }
+
+    template <typename X, bool IsOk, typename Reader>
+    static Result<result, SerializeError> read_side(Reader &in) {
+        if constexpr (std::is_void_v<X>) {
+            if constexpr (IsOk)
+                return Ok(result(Ok()));
+            else
+                return Ok(result(Err()));
+        } else {
+            auto side = serializer<X>::read(in);
+            if (side.is_err())
+                return Err(std::move(side).unwrap_err());
+
+            if constexpr (IsOk)
+                return Ok(result(Ok(std::move(side).unwrap())));
+            else
+                return Ok(result(Err(std::move(side).unwrap())));
+        }
+    }
+};
+
+// =================================================================================================
+// serialize / deserialize
+// =================================================================================================
+
+template <typename T, typename Writer>
+void serialize(const T &value, Writer &out) {
+    serializer<T>::write(value, out);
+}
+
+// Reads one record. end_of_stream means the reader was empty, i.e. the stream ended cleanly.
+template <typename T, typename Reader>
+[[nodiscard]] Result<T, SerializeError> deserialize(Reader &in) {
+    if (in.empty())
+        return Err(SerializeError::end_of_stream);
+
+    return serializer<T>::read(in);
+}
+
+// Streaming mode: passes every record of the stream to fn, in order, and returns their number once
+// the reader is empty. Stops at the first malformed record and returns its error.
+template <typename T, typename Reader, typename Fn>
+[[nodiscard]] Result<std::size_t, SerializeError> deserialize_each(Reader &in, Fn &&fn) {
+    std::size_t count = 0;
+
+    for (;;) {
+        auto record = deserialize<T>(in);
+
+        if (record.is_err()) {
+            if (record.unwrap_err_ref() == SerializeError::end_of_stream)
+                return Ok(std::move(count));
+
+            return Err(std::move(record).unwrap_err());
+        }
+
+        fn(std::move(record).unwrap());
+        ++count;
+    }
+}
+
+// =================================================================================================
+// Buffers
+// =================================================================================================
+
+// Appends to a growing byte vector.
+class BufferWriter {
+   public:
+    void write(const void *data, std::size_t size) {
+        const auto *bytes = static_cast<const std::byte *>(data);
+        m_bytes.insert(m_bytes.end(), bytes, bytes + size);
+    }
+
+    [[nodiscard]] const std::vector<std::byte> &bytes() const noexcept { return m_bytes; }
+
+    [[nodiscard]] std::vector<std::byte> take() && noexcept { return std::move(m_bytes); }
+
+    void clear() noexcept { m_bytes.clear(); }
+
+   private:
+    std::vector<std::byte> m_bytes;
+};
+
+// Reads from a byte range it does not own, e.g. BufferWriter::bytes() or a MappedFile.
+class BufferReader {
+   public:
+    BufferReader(const void *data, std::size_t size) noexcept
+        : m_next(static_cast<const std::byte *>(data)), m_end(m_next + size) {}
+
+    explicit BufferReader(const std::vector<std::byte> &bytes) noexcept
+        : BufferReader(bytes.data(), bytes.size()) {}
+
+    [[nodiscard]] bool read(void *data, std::size_t size) noexcept {
+        if (size > remaining())
+            return false;
+
+        if (size != 0)
+            std::memcpy(data, m_next, size);
+
+        m_next += size;
+        return true;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_next == m_end; }
+
+    [[nodiscard]] std::size_t remaining() const noexcept {
+        return static_cast<std::size_t>(m_end - m_next);
+    }
+
+   private:
+    const std::byte *m_next;
+    const std::byte *m_end;
+};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_SERIALIZE_HPP_
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_SITE_COUNTERS_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_SITE_COUNTERS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "detail/call_site.hpp"
+
+// =================================================================================================
+// Configuration
+// =================================================================================================
+
+// With RESULT_ENABLE_SITE_COUNTERS defined, every Err(...) construction and every unwrap() call is
+// counted per call site. Call sites are captured with __builtin_FILE/__builtin_LINE default
+// arguments, so the Result API is unchanged at the source level. Without the macro, neither the
+// counting statements nor the parameters are compiled, see detail/call_site.hpp.
+//
+// Each thread owns a shard of RESULT_SITE_COUNTERS_CAPACITY slots. Only the owning thread writes a
+// shard, so counting is a relaxed load and store without a locked instruction. Sites that do not
+// fit into a shard are accumulated in an overflow slot reported as "<overflow>".
+
+#ifndef RESULT_SITE_COUNTERS_CAPACITY
+#    define RESULT_SITE_COUNTERS_CAPACITY 256
+#endif
+
+#if defined(RESULT_ENABLE_SITE_COUNTERS) && !defined(__GNUC__) && !defined(__clang__) && \
+    !(defined(_MSC_VER) && _MSC_VER >= 1926)
+#    error "RESULT_ENABLE_SITE_COUNTERS needs __builtin_FILE and __builtin_LINE."
+#endif
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Snapshot entry
+// =================================================================================================
+
+struct site_count {
+    const char   *file;
+    std::uint32_t line;
+    std::uint64_t ok;
+    std::uint64_t err;
+};
+
+namespace detail {
+
+// =================================================================================================
+// Shards
+// =================================================================================================
+
+struct site_counter_slot {
+    std::atomic<const char *>  file{nullptr};
+    std::atomic<std::uint32_t> line{0};  // published last, 0 marks a free slot
+    std::atomic<std::uint64_t> ok{0};
+    std::atomic<std::uint64_t> err{0};
+};
+
+// Shards are never freed. A thread that exits releases its shard, and the next new thread adopts it
+// together with the counts already in it, so no samples are lost on thread exit.
+struct site_counter_shard {
+    std::array<site_counter_slot, RESULT_SITE_COUNTERS_CAPACITY> slots{};
+    site_counter_slot                                            overflow{};
+    std::atomic<bool>                                            in_use{true};
+    site_counter_shard                                          *next = nullptr;
+};
+
+inline std::atomic<site_counter_shard *> site_counter_shards{nullptr};
+
+inline thread_local site_counter_shard *site_counter_local = nullptr;
+
+struct site_counter_owner {
+    ~site_counter_owner() {
+        if (site_counter_local != nullptr)
+            site_counter_local->in_use.store(false, std::memory_order_release);
+
+        site_counter_local = nullptr;
+    }
+};
+
+[[gnu::noinline]] inline site_counter_shard *acquire_site_counter_shard() {
+    thread_local site_counter_owner owner;
+    (void)owner;
+
+    for (auto *shard = site_counter_shards.load(std::memory_order_acquire); shard != nullptr;
+         shard = shard->next) {
+        bool expected = false;
+        if (shard->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            site_counter_local = shard;
+            return shard;
+        }
+    }
+
+    auto *shard = new site_counter_shard{};
+    shard->next = site_counter_shards.load(std::memory_order_relaxed);
+    while (!site_counter_shards.compare_exchange_weak(shard->next, shard, std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+    }
+
+    site_counter_local = shard;
+    return shard;
+}
+
+inline std::size_t site_counter_hash(const char *file, std::uint32_t line) noexcept {
+    auto h = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(file)) ^
+             (static_cast<std::uint64_t>(line) * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 29;
+
+    return static_cast<std::size_t>(h);
+}
+
+inline site_counter_slot &site_counter_slot_for(call_site site) {
+    auto *shard = site_counter_local;
+    if (shard == nullptr)
+        shard = acquire_site_counter_shard();
+
+    const std::size_t mask = RESULT_SITE_COUNTERS_CAPACITY - 1;
+    std::size_t       index = site_counter_hash(site.file, site.line) & mask;
+
+    for (std::size_t probe = 0; probe < RESULT_SITE_COUNTERS_CAPACITY; ++probe) {
+        auto &slot = shard->slots[index];
+
+        // Only the owning thread inserts, so relaxed reads of our own writes are enough here.
+        const std::uint32_t line = slot.line.load(std::memory_order_relaxed);
+        if (line == site.line && slot.file.load(std::memory_order_relaxed) == site.file)
+            return slot;
+
+        if (line == 0) {
+            slot.file.store(site.file, std::memory_order_relaxed);
+            slot.line.store(site.line, std::memory_order_release);
+            return slot;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return shard->overflow;
+}
+
+inline void bump_site_counter(std::atomic<std::uint64_t> &counter) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+inline void count_site_err(call_site site) { bump_site_counter(site_counter_slot_for(site).err); }
+
+inline void count_site_unwrap(call_site site, bool ok) {
+    auto &slot = site_counter_slot_for(site);
+    bump_site_counter(ok ? slot.ok : slot.err);
+}
+
+static_assert((RESULT_SITE_COUNTERS_CAPACITY & (RESULT_SITE_COUNTERS_CAPACITY - 1)) == 0,
+              "RESULT_SITE_COUNTERS_CAPACITY must be a power of two.");
+
+}  // namespace detail
+
+// =================================================================================================
+// Snapshot
+// =================================================================================================
+
+// Aggregates all shards into one entry per call site, sorted by descending error count.
+inline std::vector<site_count> site_counters_snapshot() {
+    std::vector<site_count> out;
+
+    const auto add = [&out](const char *file, std::uint32_t line, std::uint64_t ok,
+                            std::uint64_t err) {
+        if (ok == 0 && err == 0)
+            return;
+
+        for (auto &entry : out) {
+            if (entry.line == line &&
+                (entry.file == file || std::strcmp(entry.file, file) == 0)) {
+                entry.ok += ok;
+                entry.err += err;
+                return;
+            }
+        }
+
+        out.push_back({file, line, ok, err});
+    };
+
+    for (auto *shard = detail::site_counter_shards.load(std::memory_order_acquire);
+         shard != nullptr; shard = shard->next) {
+        for (const auto &slot : shard->slots) {
+            const std::uint32_t line = slot.line.load(std::memory_order_acquire);
+            if (line == 0)
+                continue;
+
+            add(slot.file.load(std::memory_order_relaxed), line,
+                slot.ok.load(std::memory_order_relaxed), slot.err.load(std::memory_order_relaxed));
+        }
+
+        add("<overflow>", 0, shard->overflow.ok.load(std::memory_order_relaxed),
+            shard->overflow.err.load(std::memory_order_relaxed));
+    }
+
+    std::sort(out.begin(), out.end(), [](const site_count &a, const site_count &b) {
+        if (a.err != b.err)
+            return a.err > b.err;
+
+        return a.ok > b.ok;
+    });
+
+    return out;
+}
+
+inline void dump_site_counters(std::ostream &os) {
+    os << "ok\terr\tsite\n";
+
+    for (const auto &entry : site_counters_snapshot())
+        os << entry.ok << '\t' << entry.err << '\t' << entry.file << ':' << entry.line << '\n';
+}
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_SITE_COUNTERS_HPP_
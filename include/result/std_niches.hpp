@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_STD_NICHES_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_STD_NICHES_HPP_
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#    include <span>
+#endif
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "niche.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Standard library niches
+// =================================================================================================
+
+// Niches for std::unique_ptr, std::reference_wrapper, std::string_view, std::span and floating
+// point std::chrono::duration. They live apart from niche.hpp so that core.hpp does not pull in
+// <memory>, <chrono> and <functional>. Like any niche_traits specialization they change the
+// layout of Result<T, void>, so include this header wherever such a Result is used, not only in
+// some of the translation units.
+
+namespace detail {
+
+// Niche for views: an empty view whose data pointer is the non-canonical pointer sentinel.
+template <typename View, typename Pointer>
+struct view_niche {
+    static_assert(std::is_trivially_destructible_v<View>);
+
+    static Pointer sentinel() noexcept {
+        using pattern = tiny::impl::SentinelForExploitingUnusedBits<Pointer>;
+        return reinterpret_cast<Pointer>(pattern::value);
+    }
+
+    static void set_niche(View *storage) noexcept {
+        ::new (static_cast<void *>(storage)) View(sentinel(), 0);
+    }
+
+    static bool is_niche(const View *storage) noexcept { return storage->data() == sentinel(); }
+};
+
+template <typename T>
+using unique_ptr_pointer_t = typename std::unique_ptr<T>::pointer;
+
+}  // namespace detail
+
+// Only for the default deleter, where unique_ptr is a single pointer.
+template <typename T>
+struct niche_traits<std::unique_ptr<T>,
+                    std::enable_if_t<detail::has_unused_bits_v<detail::unique_ptr_pointer_t<T>>>>
+    : detail::representation_niche<std::unique_ptr<T>, detail::unique_ptr_pointer_t<T>> {};
+
+template <typename T>
+struct niche_traits<std::reference_wrapper<T>, std::enable_if_t<detail::has_unused_bits_v<T *>>>
+    : detail::representation_niche<std::reference_wrapper<T>, T *> {};
+
+template <typename CharT, typename Traits>
+struct niche_traits<std::basic_string_view<CharT, Traits>,
+                    std::enable_if_t<detail::has_unused_bits_v<const CharT *>>>
+    : detail::view_niche<std::basic_string_view<CharT, Traits>, const CharT *> {};
+
+#ifdef __cpp_lib_span
+// Dynamic extent only: a fixed-extent span cannot be empty.
+template <typename T>
+struct niche_traits<std::span<T>, std::enable_if_t<detail::has_unused_bits_v<T *>>>
+    : detail::view_niche<std::span<T>, T *> {};
+#endif
+
+// Floating point durations use an unused NaN pattern. Integral durations have no niche: every
+// count, duration::min() included, is a valid value.
+template <typename Rep, typename Period>
+struct niche_traits<std::chrono::duration<Rep, Period>,
+                    std::enable_if_t<std::is_floating_point_v<Rep> &&
+                                     detail::has_unused_bits_v<Rep>>>
+    : detail::representation_niche<std::chrono::duration<Rep, Period>, Rep> {};
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_STD_NICHES_HPP_
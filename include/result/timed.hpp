@@ -0,0 +1,365 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_TIMED_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_TIMED_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Log-bucketed latency histogram
+// =================================================================================================
+
+// HDR-style layout: values below 8 ns get one bucket each, every larger power of two is split into
+// 8 linear sub-buckets. The relative error of a bucket bound is therefore at most 12.5 %, and the
+// whole uint64_t nanosecond range fits into 496 buckets.
+class latency_histogram {
+   public:
+    static constexpr std::size_t sub_bucket_bits = 3;
+    static constexpr std::size_t sub_buckets = std::size_t{1} << sub_bucket_bits;
+    static constexpr std::size_t bucket_count = sub_buckets + (64 - sub_bucket_bits) * sub_buckets;
+
+    [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t nanos) noexcept {
+        if (nanos < sub_buckets)
+            return static_cast<std::size_t>(nanos);
+
+#if defined(__GNUC__) || defined(__clang__)
+        const auto msb = static_cast<std::size_t>(63 - __builtin_clzll(nanos));
+#else
+        std::size_t msb = 0;
+        for (auto v = nanos; v > 1; v >>= 1)
+            ++msb;
+#endif
+
+        const std::size_t shift = msb - sub_bucket_bits;
+        const auto        mantissa = static_cast<std::size_t>(nanos >> shift) & (sub_buckets - 1);
+
+        return sub_buckets + shift * sub_buckets + mantissa;
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t lower_bound(std::size_t bucket) noexcept {
+        if (bucket < sub_buckets)
+            return bucket;
+
+        const std::size_t shift = (bucket - sub_buckets) / sub_buckets;
+        const std::size_t mantissa = (bucket - sub_buckets) % sub_buckets;
+
+        return static_cast<std::uint64_t>(sub_buckets + mantissa) << shift;
+    }
+
+    void add(std::size_t bucket, std::uint64_t n) noexcept {
+        m_counts[bucket] += n;
+        m_total += n;
+    }
+
+    void merge(const latency_histogram &other) noexcept {
+        for (std::size_t i = 0; i < bucket_count; ++i)
+            m_counts[i] += other.m_counts[i];
+
+        m_total += other.m_total;
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept { return m_total; }
+
+    [[nodiscard]] std::uint64_t count_in(std::size_t bucket) const noexcept {
+        return m_counts[bucket];
+    }
+
+    // Lower bound of the bucket holding the q-th quantile (0 <= q <= 1), 0 if empty.
+    [[nodiscard]] std::uint64_t quantile(double q) const noexcept {
+        if (m_total == 0)
+            return 0;
+
+        auto rank = static_cast<std::uint64_t>(q * static_cast<double>(m_total));
+        if (rank >= m_total)
+            rank = m_total - 1;
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += m_counts[i];
+            if (seen > rank)
+                return lower_bound(i);
+        }
+
+        return lower_bound(bucket_count - 1);
+    }
+
+   private:
+    std::array<std::uint64_t, bucket_count> m_counts{};
+    std::uint64_t                           m_total = 0;
+};
+
+static_assert(latency_histogram::bucket_of(~std::uint64_t{0}) ==
+              latency_histogram::bucket_count - 1);
+
+namespace detail {
+
+// =================================================================================================
+// Per-thread shards
+// =================================================================================================
+
+// Each thread records into its own shard with relaxed load/store pairs (no locked instructions).
+// Readers merge shards with relaxed loads, so neither side ever blocks.
+//
+// A thread that exits releases its shards, and the next thread that records into the same recorder
+// adopts one of them together with the counts already in it, as the site counter shards do. A
+// recorder therefore holds at most as many shards as threads ever recorded into it at the same
+// time, however many threads come and go.
+struct latency_shard {
+    std::array<std::atomic<std::uint64_t>, latency_histogram::bucket_count> ok{};
+    std::array<std::atomic<std::uint64_t>, latency_histogram::bucket_count> err{};
+    std::atomic<bool>                                                       in_use{true};
+    latency_shard                                                          *next = nullptr;
+};
+
+inline std::atomic<std::uint64_t> next_latency_recorder_id{1};
+
+struct latency_shard_cache_entry {
+    std::uint64_t  recorder = 0;
+    latency_shard *shard = nullptr;
+};
+
+// Direct-mapped per-thread cache from recorder id to that thread's shard. Ids are never reused,
+// so a destroyed recorder can never alias a live one.
+inline thread_local std::array<latency_shard_cache_entry, 8> latency_shard_cache{};
+
+// Ids of the live recorders. A thread only releases a shard at exit while its recorder is still
+// registered, so it never touches a shard that the recorder's destructor has freed. Leaked so that
+// recorders and threads that go away during static destruction can still use it.
+struct latency_recorder_registry {
+    std::mutex                 mutex;
+    std::vector<std::uint64_t> live;
+
+    [[nodiscard]] bool is_live(std::uint64_t id) const noexcept {
+        return std::find(live.begin(), live.end(), id) != live.end();
+    }
+};
+
+inline latency_recorder_registry &latency_recorders() {
+    static auto *registry = new latency_recorder_registry;
+    return *registry;
+}
+
+// Every shard the thread holds, released when the thread exits.
+struct latency_shard_owner {
+    std::vector<latency_shard_cache_entry> held;
+
+    ~latency_shard_owner() {
+        auto                       &registry = latency_recorders();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for (const auto &entry : held) {
+            if (registry.is_live(entry.recorder))
+                entry.shard->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+inline thread_local latency_shard_owner latency_shard_owner_local;
+
+inline void bump_latency_bucket(std::atomic<std::uint64_t> &bucket) noexcept {
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+// =================================================================================================
+// Recorder
+// =================================================================================================
+
+template <typename Clock = std::chrono::steady_clock>
+class basic_latency_recorder {
+   public:
+    using clock = Clock;
+
+    basic_latency_recorder() {
+        auto                       &registry = detail::latency_recorders();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.live.push_back(m_id);
+    }
+
+    basic_latency_recorder(const basic_latency_recorder &) = delete;
+    basic_latency_recorder &operator=(const basic_latency_recorder &) = delete;
+
+    // Threads must have stopped recording before the recorder is destroyed.
+    ~basic_latency_recorder() {
+        {
+            auto                       &registry = detail::latency_recorders();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.live.erase(std::find(registry.live.begin(), registry.live.end(), m_id));
+        }
+
+        auto *shard = m_shards.load(std::memory_order_acquire);
+        while (shard != nullptr) {
+            auto *next = shard->next;
+            delete shard;
+            shard = next;
+        }
+    }
+
+    void record(bool ok, std::uint64_t nanos) {
+        auto &shard = local_shard();
+        const auto bucket = latency_histogram::bucket_of(nanos);
+
+        detail::bump_latency_bucket(ok ? shard.ok[bucket] : shard.err[bucket]);
+    }
+
+    [[nodiscard]] latency_histogram ok_histogram() const {
+        return collect(&detail::latency_shard::ok);
+    }
+
+    [[nodiscard]] latency_histogram err_histogram() const {
+        return collect(&detail::latency_shard::err);
+    }
+
+    // Number of per-thread shards, bounded by the number of threads recording at the same time.
+    [[nodiscard]] std::size_t shard_count() const noexcept {
+        std::size_t count = 0;
+        for (auto *shard = m_shards.load(std::memory_order_acquire); shard != nullptr;
+             shard = shard->next)
+            ++count;
+
+        return count;
+    }
+
+   private:
+    using buckets_t = std::array<std::atomic<std::uint64_t>, latency_histogram::bucket_count>;
+
+    detail::latency_shard &local_shard() {
+        auto &entry = detail::latency_shard_cache[m_id % detail::latency_shard_cache.size()];
+        if (entry.recorder == m_id)
+            return *entry.shard;
+
+        entry.recorder = m_id;
+        entry.shard = find_or_add_shard();
+        return *entry.shard;
+    }
+
+    [[gnu::noinline]] detail::latency_shard *find_or_add_shard() {
+        auto &held = detail::latency_shard_owner_local.held;
+
+        for (const auto &entry : held) {
+            if (entry.recorder == m_id)
+                return entry.shard;
+        }
+
+        // Drops the shards of recorders that are gone, so a long-lived thread does not accumulate
+        // them.
+        {
+            auto                       &registry = detail::latency_recorders();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            held.erase(std::remove_if(held.begin(), held.end(),
+                                      [&](const detail::latency_shard_cache_entry &entry) {
+                                          return !registry.is_live(entry.recorder);
+                                      }),
+                       held.end());
+        }
+
+        auto *shard = acquire_shard();
+        held.push_back({m_id, shard});
+        return shard;
+    }
+
+    // Adopts a shard released by an exited thread, or adds a new one.
+    detail::latency_shard *acquire_shard() {
+        for (auto *shard = m_shards.load(std::memory_order_acquire); shard != nullptr;
+             shard = shard->next) {
+            bool expected = false;
+            if (shard->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return shard;
+        }
+
+        auto *shard = new detail::latency_shard{};
+        shard->next = m_shards.load(std::memory_order_relaxed);
+        while (!m_shards.compare_exchange_weak(shard->next, shard, std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+
+        return shard;
+    }
+
+    latency_histogram collect(buckets_t detail::latency_shard::*which) const {
+        latency_histogram out;
+
+        for (auto *shard = m_shards.load(std::memory_order_acquire); shard != nullptr;
+             shard = shard->next) {
+            const auto &buckets = shard->*which;
+            for (std::size_t i = 0; i < latency_histogram::bucket_count; ++i) {
+                const auto n = buckets[i].load(std::memory_order_relaxed);
+                if (n != 0)
+                    out.add(i, n);
+            }
+        }
+
+        return out;
+    }
+
+    std::uint64_t                        m_id = detail::next_latency_recorder_id.fetch_add(1);
+    std::atomic<detail::latency_shard *> m_shards{nullptr};
+};
+
+using latency_recorder = basic_latency_recorder<>;
+
+// =================================================================================================
+// timed() adapter
+// =================================================================================================
+
+template <typename Fn, typename Clock>
+class timed_fn {
+   public:
+    timed_fn(basic_latency_recorder<Clock> &recorder, Fn fn)
+        : m_recorder(&recorder), m_fn(std::move(fn)) {}
+
+    template <typename... Args>
+    auto operator()(Args &&...args) {
+        using Ret = std::invoke_result_t<Fn &, Args...>;
+        static_assert(detail::is_result<Ret>::value, "timed() callable must return a Result.");
+
+        const auto start = Clock::now();
+        Ret        result = std::invoke(m_fn, std::forward<Args>(args)...);
+        const auto elapsed = Clock::now() - start;
+
+        m_recorder->record(
+            result.is_ok(),
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+
+        return result;
+    }
+
+   private:
+    basic_latency_recorder<Clock> *m_recorder;
+    Fn                             m_fn;
+};
+
+// Wraps a Result-returning callable so that every call records its latency into the Ok or Err
+// histogram of `recorder`, depending on the outcome.
+template <typename Clock, typename Fn>
+[[nodiscard]] auto timed(basic_latency_recorder<Clock> &recorder, Fn &&fn) {
+    return timed_fn<std::decay_t<Fn>, Clock>(recorder, std::forward<Fn>(fn));
+}
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_TIMED_HPP_
@@ -0,0 +1,478 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef LRUSINGER_RESULT_INCLUDE_RESULT_URING_HPP_
+#define LRUSINGER_RESULT_INCLUDE_RESULT_URING_HPP_
+
+#if !__has_include(<linux/io_uring.h>)
+#    error "result/uring.hpp requires Linux."
+#endif
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#    include <coroutine>
+#    define RESULT_URING_COROUTINES
+#endif
+
+// =================================================================================================
+// Project files
+// =================================================================================================
+
+#include "core.hpp"
+#include "fd.hpp"
+#include "posix.hpp"
+
+#ifdef RESULT_NAMESPACE
+namespace lsr::result {
+#endif
+
+// =================================================================================================
+// Completions
+// =================================================================================================
+
+namespace detail {
+
+// A CQE's res is the syscall's return value or a negated errno, never both.
+[[nodiscard]] inline Result<std::uint32_t, Errno> cqe_result(std::int32_t res) noexcept {
+    if (res < 0)
+        return Err(static_cast<Errno>(-res));
+
+    return Ok(static_cast<std::uint32_t>(res));
+}
+
+// The rings are shared with the kernel, which pairs these with its own acquire/release accesses.
+template <typename T>
+[[nodiscard]] T load_acquire(const T *p) noexcept {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+void store_release(T *p, T value) noexcept {
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+}  // namespace detail
+
+// Result<std::uint32_t, Errno> is 8 bytes: the flat union of the two 4-byte sides plus a flag byte,
+// rounded up to the alignment of uint32_t. Errno's niche only applies when Ok is void.
+struct UringCompletion {
+    std::uint64_t                user_data;
+    Result<std::uint32_t, Errno> result;
+};
+
+static_assert(sizeof(Result<std::uint32_t, Errno>) == 8 && !has_niche_v<std::uint32_t>);
+static_assert(sizeof(UringCompletion) == 16);
+
+#ifdef RESULT_URING_COROUTINES
+class UringOp;
+#endif
+
+// =================================================================================================
+// Uring
+// =================================================================================================
+
+// Minimal io_uring front end on the raw syscalls, without liburing. Ops are prepared into the
+// submission queue with the prep_* functions, handed to the kernel in one batch by submit() and
+// collected by reap(). Each completion carries the CQE res field as Result<std::uint32_t, Errno>.
+//
+// Link an op to the next one with link(sqe): the next op then starts only after this one succeeded
+// and completes with ECANCELED otherwise. Under C++20, co_await async_read(...) and friends suspend
+// the coroutine until reap() sees the completion.
+//
+// A Uring is used by one thread at a time. SQPOLL rings and big SQEs/CQEs are not supported.
+class Uring {
+   public:
+    // user_data values with this bit set are reserved for awaited ops.
+    static constexpr std::uint64_t awaiter_tag = std::uint64_t{1} << 63;
+
+    [[nodiscard]] static Result<Uring, Errno> create(unsigned entries,
+                                                     unsigned flags = 0) noexcept {
+        if (flags & unsupported_flags)
+            return Err(Errno{EINVAL});
+
+        io_uring_params params{};
+        params.flags = flags;
+
+        const auto fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+
+        if (fd < 0)
+            return Err(posix::last_errno());
+
+        Uring ring;
+        ring.m_fd.reset(fd);
+
+        if (auto mapped = ring.map(params); mapped.is_err())
+            return Err(std::move(mapped).unwrap_err());
+
+        return Ok(std::move(ring));
+    }
+
+    Uring(const Uring &) = delete;
+    Uring &operator=(const Uring &) = delete;
+
+    Uring(Uring &&other) noexcept { steal(other); }
+
+    Uring &operator=(Uring &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    ~Uring() { unmap(); }
+
+    [[nodiscard]] int fd() const noexcept { return m_fd.get(); }
+
+    // =============================================================================================
+    // Submission
+    // =============================================================================================
+
+    // A zeroed SQE queued behind the ones prepared so far, or nullptr when the submission queue is
+    // full. Nothing reaches the kernel before submit().
+    [[nodiscard]] io_uring_sqe *next_sqe() noexcept {
+        if (m_sq_tail - detail::load_acquire(m_sq_head) >= m_sq_entries)
+            return nullptr;
+
+        io_uring_sqe *sqe = &m_sqes[m_sq_tail & m_sq_mask];
+        ++m_sq_tail;
+
+        std::memset(static_cast<void *>(sqe), 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    io_uring_sqe *prep_nop(std::uint64_t user_data) noexcept {
+        return prep(IORING_OP_NOP, -1, 0, 0, 0, user_data);
+    }
+
+    io_uring_sqe *prep_read(int fd, void *buf, std::uint32_t count, std::uint64_t offset,
+                            std::uint64_t user_data) noexcept {
+        return prep(IORING_OP_READ, fd, reinterpret_cast<std::uintptr_t>(buf), count, offset,
+                    user_data);
+    }
+
+    io_uring_sqe *prep_write(int fd, const void *buf, std::uint32_t count, std::uint64_t offset,
+                             std::uint64_t user_data) noexcept {
+        return prep(IORING_OP_WRITE, fd, reinterpret_cast<std::uintptr_t>(buf), count, offset,
+                    user_data);
+    }
+
+    io_uring_sqe *prep_fsync(int fd, std::uint64_t user_data) noexcept {
+        return prep(IORING_OP_FSYNC, fd, 0, 0, 0, user_data);
+    }
+
+    // Makes the op after sqe wait for it. Accepts nullptr so that prep_* results chain directly.
+    static io_uring_sqe *link(io_uring_sqe *sqe) noexcept {
+        if (sqe)
+            sqe->flags |= IOSQE_IO_LINK;
+
+        return sqe;
+    }
+
+    // Hands every prepared SQE to the kernel in one io_uring_enter and, with wait_for > 0, blocks
+    // until that many completions are available. Returns the number of SQEs consumed.
+    Result<std::uint32_t, Errno> submit(unsigned wait_for = 0) noexcept {
+        detail::store_release(m_sq_tail_shared, m_sq_tail);
+
+        const unsigned pending = m_sq_tail - detail::load_acquire(m_sq_head);
+        const unsigned flags = wait_for > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+        const auto ret = posix::detail::retry_on_eintr([&] {
+            return ::syscall(__NR_io_uring_enter, m_fd.get(), pending, wait_for, flags, nullptr,
+                             0);
+        });
+
+        if (ret < 0)
+            return Err(posix::last_errno());
+
+        return Ok(static_cast<std::uint32_t>(ret));
+    }
+
+    // =============================================================================================
+    // Completion
+    // =============================================================================================
+
+    // Consumes every available CQE. Awaited ops resume their coroutine; everything else is passed
+    // to fn as a UringCompletion. The CQE is released before fn runs, so fn may prepare, submit and
+    // reap. Returns the number of CQEs consumed.
+    template <typename Fn>
+    std::size_t reap(Fn &&fn) {
+        std::size_t reaped = 0;
+
+        for (;;) {
+            const unsigned head = *m_cq_head;
+
+            if (head == detail::load_acquire(m_cq_tail))
+                return reaped;
+
+            const io_uring_cqe &cqe = m_cqes[head & m_cq_mask];
+            const std::uint64_t user_data = cqe.user_data;
+            const std::int32_t  res = cqe.res;
+
+            detail::store_release(m_cq_head, head + 1);
+            ++reaped;
+
+            if (user_data & awaiter_tag)
+                resume(user_data, res);
+            else
+                fn(UringCompletion{user_data, detail::cqe_result(res)});
+        }
+    }
+
+    // For rings whose ops are all awaited.
+    std::size_t reap() {
+        return reap([](const UringCompletion &) {});
+    }
+
+#ifdef RESULT_URING_COROUTINES
+    // =============================================================================================
+    // Coroutines
+    // =============================================================================================
+
+    // Awaits an op prepared with prep_*; its user_data is overwritten. A nullptr sqe, i.e. a full
+    // submission queue, completes immediately with EBUSY.
+    [[nodiscard]] UringOp async(io_uring_sqe *sqe) noexcept;
+
+    [[nodiscard]] UringOp async_nop() noexcept;
+
+    [[nodiscard]] UringOp async_read(int fd, void *buf, std::uint32_t count,
+                                     std::uint64_t offset) noexcept;
+
+    [[nodiscard]] UringOp async_write(int fd, const void *buf, std::uint32_t count,
+                                      std::uint64_t offset) noexcept;
+
+    [[nodiscard]] UringOp async_fsync(int fd) noexcept;
+#endif
+
+   private:
+    static constexpr unsigned unsupported_flags = IORING_SETUP_SQPOLL
+#ifdef IORING_SETUP_SQE128
+                                                  | IORING_SETUP_SQE128
+#endif
+#ifdef IORING_SETUP_CQE32
+                                                  | IORING_SETUP_CQE32
+#endif
+        ;
+
+    Uring() noexcept = default;
+
+    template <typename T>
+    static T *at(void *ring, std::uint32_t offset) noexcept {
+        return reinterpret_cast<T *>(static_cast<char *>(ring) + offset);
+    }
+
+    Result<void, Errno> map(const io_uring_params &params) noexcept {
+        m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+        m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+        // Since 5.4 both rings live in one mapping.
+        const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap)
+            m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+
+        constexpr int prot = PROT_READ | PROT_WRITE;
+        constexpr int flags = MAP_SHARED | MAP_POPULATE;
+
+        auto sq_ring = posix::mmap(nullptr, m_sq_ring_size, prot, flags, fd(), IORING_OFF_SQ_RING);
+        if (sq_ring.is_err())
+            return Err(std::move(sq_ring).unwrap_err());
+
+        m_sq_ring = sq_ring.unwrap_ref();
+
+        if (single_mmap) {
+            m_cq_ring = m_sq_ring;
+        } else {
+            auto cq_ring =
+                posix::mmap(nullptr, m_cq_ring_size, prot, flags, fd(), IORING_OFF_CQ_RING);
+            if (cq_ring.is_err())
+                return Err(std::move(cq_ring).unwrap_err());
+
+            m_cq_ring = cq_ring.unwrap_ref();
+        }
+
+        auto sqes = posix::mmap(nullptr, m_sqes_size, prot, flags, fd(), IORING_OFF_SQES);
+        if (sqes.is_err())
+            return Err(std::move(sqes).unwrap_err());
+
+        m_sqes = static_cast<io_uring_sqe *>(sqes.unwrap_ref());
+
+        m_sq_head = at<unsigned>(m_sq_ring, params.sq_off.head);
+        m_sq_tail_shared = at<unsigned>(m_sq_ring, params.sq_off.tail);
+        m_sq_mask = *at<unsigned>(m_sq_ring, params.sq_off.ring_mask);
+        m_sq_entries = *at<unsigned>(m_sq_ring, params.sq_off.ring_entries);
+        m_sq_tail = *m_sq_tail_shared;
+
+        m_cq_head = at<unsigned>(m_cq_ring, params.cq_off.head);
+        m_cq_tail = at<unsigned>(m_cq_ring, params.cq_off.tail);
+        m_cq_mask = *at<unsigned>(m_cq_ring, params.cq_off.ring_mask);
+        m_cqes = at<io_uring_cqe>(m_cq_ring, params.cq_off.cqes);
+
+        // SQE i always sits in slot i of the indirection array.
+        auto *array = at<unsigned>(m_sq_ring, params.sq_off.array);
+        for (unsigned i = 0; i < m_sq_entries; ++i)
+            array[i] = i;
+
+        return Ok();
+    }
+
+    void unmap() noexcept {
+        if (m_sqes)
+            ::munmap(m_sqes, m_sqes_size);
+
+        if (m_cq_ring && m_cq_ring != m_sq_ring)
+            ::munmap(m_cq_ring, m_cq_ring_size);
+
+        if (m_sq_ring)
+            ::munmap(m_sq_ring, m_sq_ring_size);
+
+        m_sqes = nullptr;
+        m_sq_ring = m_cq_ring = nullptr;
+        m_fd.reset();
+    }
+
+    void steal(Uring &other) noexcept {
+        m_fd = std::move(other.m_fd);
+        m_sq_ring = std::exchange(other.m_sq_ring, nullptr);
+        m_cq_ring = std::exchange(other.m_cq_ring, nullptr);
+        m_sqes = std::exchange(other.m_sqes, nullptr);
+        m_sq_ring_size = other.m_sq_ring_size;
+        m_cq_ring_size = other.m_cq_ring_size;
+        m_sqes_size = other.m_sqes_size;
+        m_sq_head = other.m_sq_head;
+        m_sq_tail_shared = other.m_sq_tail_shared;
+        m_sq_tail = other.m_sq_tail;
+        m_sq_mask = other.m_sq_mask;
+        m_sq_entries = other.m_sq_entries;
+        m_cq_head = other.m_cq_head;
+        m_cq_tail = other.m_cq_tail;
+        m_cq_mask = other.m_cq_mask;
+        m_cqes = other.m_cqes;
+    }
+
+    io_uring_sqe *prep(std::uint8_t opcode, int fd, std::uint64_t addr, std::uint32_t len,
+                       std::uint64_t offset, std::uint64_t user_data) noexcept {
+        io_uring_sqe *sqe = next_sqe();
+
+        if (sqe) {
+            sqe->opcode = opcode;
+            sqe->fd = fd;
+            sqe->addr = addr;
+            sqe->len = len;
+            sqe->off = offset;
+            sqe->user_data = user_data;
+        }
+
+        return sqe;
+    }
+
+    inline void resume(std::uint64_t user_data, std::int32_t res);
+
+    Fd            m_fd;
+    void         *m_sq_ring = nullptr;
+    void         *m_cq_ring = nullptr;
+    io_uring_sqe *m_sqes = nullptr;
+    std::size_t   m_sq_ring_size = 0;
+    std::size_t   m_cq_ring_size = 0;
+    std::size_t   m_sqes_size = 0;
+
+    // Kernel-shared ring indices; m_sq_tail is the local tail, published by submit().
+    unsigned     *m_sq_head = nullptr;
+    unsigned     *m_sq_tail_shared = nullptr;
+    unsigned      m_sq_tail = 0;
+    unsigned      m_sq_mask = 0;
+    unsigned      m_sq_entries = 0;
+    unsigned     *m_cq_head = nullptr;
+    unsigned     *m_cq_tail = nullptr;
+    unsigned      m_cq_mask = 0;
+    io_uring_cqe *m_cqes = nullptr;
+};
+
+#ifdef RESULT_URING_COROUTINES
+// =================================================================================================
+// UringOp
+// =================================================================================================
+
+// Awaiter for one submitted op; co_await yields its Result<std::uint32_t, Errno>. The op's
+// user_data points at the awaiter, which therefore cannot move and must outlive the op: co_await it
+// directly, or keep it in the coroutine frame until it has completed. A completion reaped before
+// the co_await is stored and returned without suspending.
+class [[nodiscard]] UringOp {
+   public:
+    explicit UringOp(io_uring_sqe *sqe) noexcept {
+        if (sqe)
+            sqe->user_data = reinterpret_cast<std::uintptr_t>(this) | Uring::awaiter_tag;
+        else
+            complete(-EBUSY);
+    }
+
+    UringOp(const UringOp &) = delete;
+    UringOp &operator=(const UringOp &) = delete;
+
+    [[nodiscard]] bool await_ready() const noexcept { return m_done; }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept { m_handle = handle; }
+
+    [[nodiscard]] Result<std::uint32_t, Errno> await_resume() const noexcept {
+        return detail::cqe_result(m_res);
+    }
+
+   private:
+    friend class Uring;
+
+    void complete(std::int32_t res) {
+        m_res = res;
+        m_done = true;
+
+        if (m_handle)
+            m_handle.resume();
+    }
+
+    std::coroutine_handle<> m_handle;
+    std::int32_t            m_res = 0;
+    bool                    m_done = false;
+};
+
+inline void Uring::resume(std::uint64_t user_data, std::int32_t res) {
+    auto *op = reinterpret_cast<UringOp *>(static_cast<std::uintptr_t>(user_data & ~awaiter_tag));
+    op->complete(res);
+}
+
+inline UringOp Uring::async(io_uring_sqe *sqe) noexcept { return UringOp(sqe); }
+
+inline UringOp Uring::async_nop() noexcept { return UringOp(prep_nop(0)); }
+
+inline UringOp Uring::async_read(int fd, void *buf, std::uint32_t count,
+                                 std::uint64_t offset) noexcept {
+    return UringOp(prep_read(fd, buf, count, offset, 0));
+}
+
+inline UringOp Uring::async_write(int fd, const void *buf, std::uint32_t count,
+                                  std::uint64_t offset) noexcept {
+    return UringOp(prep_write(fd, buf, count, offset, 0));
+}
+
+inline UringOp Uring::async_fsync(int fd) noexcept { return UringOp(prep_fsync(fd, 0)); }
+#else
+// Without coroutines nothing submits tagged ops, so there is nothing to resume.
+inline void Uring::resume(std::uint64_t, std::int32_t) {}
+#endif
+
+#undef RESULT_URING_COROUTINES
+
+#ifdef RESULT_NAMESPACE
+}  // namespace lsr::result
+#endif
+
+#endif  // LRUSINGER_RESULT_INCLUDE_RESULT_URING_HPP_
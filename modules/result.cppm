@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+
+// C++20 module interface of the library: `import lsr.result;` instead of including the headers.
+// Macros do not cross an import, so RESULT_NAMESPACE, RESULT_ENABLE_USDT and the other
+// configuration macros have to be set on the module target itself, and the macro-based helpers
+// (error backtraces, call-site counters) are only available through the headers.
+//
+// The library headers are included inside the export block, so that every declaration they make
+// is exported as is. Re-exporting names from the global module fragment with using-declarations
+// does not work for the default configuration: without RESULT_NAMESPACE the names live in the
+// global namespace, and a using-declaration cannot re-declare a name in its own namespace (GCC 12
+// silently exports nothing). The global module fragment therefore only holds the standard and
+// system headers, which the include guards then skip inside the export block, and the vendored
+// tiny::optional, which has internal-linkage helpers that cannot be exported.
+//
+// Platform-specific headers are exported where they are available: posix.hpp, fd.hpp,
+// mapped_file.hpp, record_reader.hpp and result_log.hpp need <unistd.h>, uring.hpp needs
+// <linux/io_uring.h> and expected.hpp needs C++23 std::expected.
+//
+// GCC 12 only consumes the core of the module: Result, Ok/Err, PtrResult and the niche traits.
+// Templates instantiated with the library's own types (ParseError, Errno, MappedFile, ...) fail to
+// link or crash the importer, and std::chrono operators are not found through the import, which
+// rules out retry.hpp, timed.hpp and result_cache.hpp. Translation units that need those include
+// the headers instead of importing the module.
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if __has_include(<compare>)
+#    include <compare>
+#endif
+
+#if __has_include(<coroutine>)
+#    include <coroutine>
+#endif
+
+#if __has_include(<span>)
+#    include <span>
+#endif
+
+#if __has_include(<version>)
+#    include <version>
+#endif
+
+#if __has_include(<expected>)
+#    include <expected>
+#endif
+
+#if __has_include(<unistd.h>)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <sys/types.h>
+#    include <unistd.h>
+#    define RESULT_MODULE_POSIX
+#endif
+
+#if __has_include(<sys/epoll.h>)
+#    include <sys/epoll.h>
+#endif
+
+#if __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#    include <sys/syscall.h>
+#    define RESULT_MODULE_URING
+#endif
+
+#include <result/detail/optional.hpp>
+#include <result/detail/usdt.hpp>
+
+export module lsr.result;
+
+export {
+#include <result/core.hpp>
+#include <result/niche.hpp>
+#include <result/parse.hpp>
+#include <result/ptr_result.hpp>
+#include <result/result_cache.hpp>
+#include <result/retry.hpp>
+#include <result/serialize.hpp>
+#include <result/std_niches.hpp>
+#include <result/timed.hpp>
+
+#ifdef RESULT_MODULE_POSIX
+#    include <result/fd.hpp>
+#    include <result/mapped_file.hpp>
+#    include <result/posix.hpp>
+#    include <result/record_reader.hpp>
+#    include <result/result_log.hpp>
+#endif
+
+#ifdef RESULT_MODULE_URING
+#    include <result/uring.hpp>
+#endif
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+#    include <result/expected.hpp>
+#endif
+}
@@ -0,0 +1,19 @@
+# Verifies that a binary carries the USDT notes emitted by result/detail/usdt.hpp.
+#
+# Usage: cmake -DREADELF=<readelf> -DBINARY=<path> -P check_usdt_notes.cmake
+
+execute_process(
+        COMMAND ${READELF} --notes ${BINARY}
+        OUTPUT_VARIABLE notes
+        RESULT_VARIABLE status
+)
+
+if(NOT status EQUAL 0)
+    message(FATAL_ERROR "readelf failed on ${BINARY}")
+endif()
+
+foreach(probe err panic throw)
+    if(NOT notes MATCHES "Provider: result[\r\n]+[ \t]*Name: ${probe}[\r\n]")
+        message(FATAL_ERROR "USDT probe result:${probe} not found in ${BINARY}")
+    endif()
+endforeach()
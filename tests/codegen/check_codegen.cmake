@@ -0,0 +1,81 @@
+# Checks the disassembly of the codegen probes against the budgets declared in their source.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECT=<probes.o> -DSOURCE=<probes.cpp> -P check_codegen.cmake
+#
+# For every "// codegen-budget: <symbol> <max>" line in SOURCE the probe must
+#   - exist in OBJECT,
+#   - have at most <max> instructions (alignment padding excluded),
+#   - contain no call and no branch that leaves the function (tail calls, .cold splits).
+# The object must be built with -ffunction-sections so that any cross-function branch carries a
+# relocation.
+
+file(STRINGS ${SOURCE} budget_lines REGEX "// codegen-budget: [A-Za-z0-9_]+ [0-9]+")
+
+execute_process(
+        COMMAND ${OBJDUMP} -dr --no-show-raw-insn ${OBJECT}
+        OUTPUT_VARIABLE disassembly
+        RESULT_VARIABLE status
+)
+
+if(NOT status EQUAL 0)
+    message(FATAL_ERROR "objdump failed on ${OBJECT}")
+endif()
+
+string(REPLACE ";" "\;" disassembly "${disassembly}")
+string(REPLACE "\n" ";" disassembly "${disassembly}")
+
+set(failures "")
+
+foreach(budget_line IN LISTS budget_lines)
+    string(REGEX MATCH "codegen-budget: ([A-Za-z0-9_]+) ([0-9]+)" _ "${budget_line}")
+    set(symbol ${CMAKE_MATCH_1})
+    set(max ${CMAKE_MATCH_2})
+
+    set(inside FALSE)
+    set(found FALSE)
+    set(count 0)
+    set(body "")
+
+    foreach(line IN LISTS disassembly)
+        if(line MATCHES "^[0-9a-f]+ <([^>]+)>:$")
+            if(CMAKE_MATCH_1 STREQUAL symbol)
+                set(inside TRUE)
+                set(found TRUE)
+            else()
+                set(inside FALSE)
+            endif()
+        elseif(inside AND line MATCHES "^Disassembly of section")
+            set(inside FALSE)
+        elseif(inside AND line MATCHES "^[ \t]+[0-9a-f]+:[ \t]+R_")
+            # A relocation inside a probe means it references code or data outside of itself.
+            if(line MATCHES "R_[A-Z0-9_]*(PLT32|CALL26|JUMP26|CONDBR19|TSTBR14)|[ \t]\\.text")
+                list(APPEND failures "${symbol}: leaves the function (${line})")
+            endif()
+        elseif(inside AND line MATCHES "^[ \t]+[0-9a-f]+:[ \t]+([a-z][a-z0-9.]*)")
+            set(mnemonic ${CMAKE_MATCH_1})
+            if(line MATCHES "[ \t](nop[a-z]*|xchg +%ax,%ax)([ \t]|$)")
+                continue()
+            endif()
+
+            if(mnemonic MATCHES "^(call|callq|bl|blr)$")
+                list(APPEND failures "${symbol}: contains a call (${line})")
+            endif()
+
+            math(EXPR count "${count} + 1")
+            string(APPEND body "\n${line}")
+        endif()
+    endforeach()
+
+    if(NOT found)
+        list(APPEND failures "${symbol}: not found in ${OBJECT}")
+    elseif(count GREATER max)
+        list(APPEND failures "${symbol}: ${count} instructions, budget is ${max}${body}")
+    else()
+        message(STATUS "${symbol}: ${count}/${max} instructions")
+    endif()
+endforeach()
+
+if(failures)
+    string(REPLACE ";" "\n" failures "${failures}")
+    message(FATAL_ERROR "codegen budget exceeded:\n${failures}")
+endif()
@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "../../include/result/ptr_result.hpp"
+#include "../../include/result/result.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// Hot-path probes for check_codegen.cmake. Every probe is extern "C" so that its symbol is stable
+// across compilers, and carries a budget line of the form
+//
+//     // codegen-budget: <symbol> <max instructions>
+//
+// No probe may contain a call or a jump into another function.
+
+enum class ErrCode : std::uint8_t { failed = 1, timeout = 2 };
+
+extern "C" {
+
+// codegen-budget: codegen_is_ok 3
+bool codegen_is_ok(const Result<int, ErrCode> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_unwrap_unchecked 2
+int codegen_unwrap_unchecked(Result<int, ErrCode> *r) { return std::move(*r).unwrap_unchecked(); }
+
+// codegen-budget: codegen_unwrap_or 5
+int codegen_unwrap_or(Result<int, ErrCode> *r) { return std::move(*r).unwrap_or(0); }
+
+// codegen-budget: codegen_unwrap_err_unchecked 2
+ErrCode codegen_unwrap_err_unchecked(Result<int, ErrCode> *r) {
+    return std::move(*r).unwrap_err_unchecked();
+}
+
+// codegen-budget: codegen_make_ok 3
+Result<int, ErrCode> codegen_make_ok(int x) { return Ok(std::move(x)); }
+
+// codegen-budget: codegen_make_err 2
+Result<int, ErrCode> codegen_make_err(ErrCode e) { return Err(std::move(e)); }
+
+// codegen-budget: codegen_is_ok_ptr 4
+bool codegen_is_ok_ptr(const Result<int *, void> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_unwrap_or_default_ptr 6
+int *codegen_unwrap_or_default_ptr(Result<int *, void> *r) {
+    return std::move(*r).unwrap_or_default();
+}
+
+// codegen-budget: codegen_is_ok_ptr_enum 3
+bool codegen_is_ok_ptr_enum(const Result<int *, ErrCode> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_unwrap_err_ptr_enum 2
+ErrCode codegen_unwrap_err_ptr_enum(Result<int *, ErrCode> *r) {
+    return std::move(*r).unwrap_err_unchecked();
+}
+
+// codegen-budget: codegen_is_ok_tagged 4
+bool codegen_is_ok_tagged(const PtrResult<std::uint64_t, ErrCode> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_get_tagged 5
+std::uint64_t *codegen_get_tagged(const PtrResult<std::uint64_t, ErrCode> *r) { return r->get(); }
+
+// codegen-budget: codegen_is_ok_void 3
+bool codegen_is_ok_void(const Result<void, ErrCode> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_is_ok_bool 2
+bool codegen_is_ok_bool(const Result<void, void> *r) { return r->is_ok(); }
+
+// codegen-budget: codegen_hash_niche 2
+std::size_t codegen_hash_niche(const Result<int, void, -1> *r) {
+    return std::hash<Result<int, void, -1>>{}(*r);
+}
+
+// codegen-budget: codegen_hash_niche_ptr 2
+std::size_t codegen_hash_niche_ptr(const Result<int *, void> *r) {
+    return std::hash<Result<int *, void>>{}(*r);
+}
+
+// codegen-budget: codegen_map 6
+int codegen_map(Result<int, ErrCode> *r) {
+    return std::move(*r).map([](int v) { return v * 2; }).unwrap_or(-1);
+}
+
+// codegen-budget: codegen_and_then 9
+int codegen_and_then(Result<int, ErrCode> *r) {
+    return std::move(*r)
+        .and_then([](int v) -> Result<int, ErrCode> {
+            if (v < 0)
+                return Err(ErrCode::failed);
+
+            return Ok(v + 1);
+        })
+        .unwrap_or(0);
+}
+}
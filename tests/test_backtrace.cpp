@@ -0,0 +1,127 @@
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../include/result/backtrace.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class IoError : std::uint8_t { timeout = 0, refused = 1 };
+
+static constexpr int traced_line = __LINE__ + 3;
+
+[[gnu::noinline]] static Result<int, IoError> fail_every_time(int) {
+    return RESULT_TRACED_ERR_N(IoError::timeout, 4);
+}
+
+[[gnu::noinline]] static Result<int, std::string> fail_with_string() {
+    std::string message = "refused";
+    return RESULT_TRACED_ERR_N(std::move(message), 1);
+}
+
+[[maybe_unused]] static int count_backtraces() {
+    int count = 0;
+    visit_err_backtraces([&count](const err_backtrace&) { ++count; });
+    return count;
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_traced_err_is_plain_err() {
+    clear_err_backtraces();
+
+    auto err = RESULT_TRACED_ERR_N(IoError::refused, 1);
+
+    static_assert(std::is_same_v<decltype(err), wrapper::Err<IoError>>);
+    assert(err.value == IoError::refused);
+
+    Result<void, IoError> r(std::move(err));
+
+    assert(r.is_err());
+    assert(r.unwrap_err_ref() == IoError::refused);
+}
+
+static void test_sampling_rate_per_call_site() {
+    clear_err_backtraces();
+
+    for (int i = 0; i < 8; ++i) {
+        auto r = fail_every_time(i);
+        assert(r.is_err());
+    }
+
+    // rate 4 -> the 1st and 5th evaluation are sampled
+    assert(count_backtraces() == 2);
+
+    visit_err_backtraces([](const err_backtrace& bt) {
+        assert(std::string{bt.file}.find("test_backtrace.cpp") != std::string::npos);
+        assert(bt.line == traced_line);
+        assert(bt.depth > 0);
+        (void)bt;
+    });
+}
+
+static void test_sampling_counters_are_per_thread() {
+    clear_err_backtraces();
+
+    // Each new thread starts its own count, so its first evaluation is sampled.
+    for (int i = 0; i < 3; ++i)
+        std::thread([] { (void)fail_every_time(0); }).join();
+
+    assert(count_backtraces() == 3);
+}
+
+static void test_moved_payload() {
+    clear_err_backtraces();
+
+    auto r = fail_with_string();
+
+    assert(r.is_err());
+    assert(r.unwrap_err_ref() == "refused");
+    assert(count_backtraces() == 1);
+}
+
+static void test_ring_buffer_is_bounded() {
+    clear_err_backtraces();
+
+    for (int i = 0; i < RESULT_ERR_BACKTRACE_CAPACITY + 10; ++i)
+        (void)fail_with_string();
+
+    assert(count_backtraces() == RESULT_ERR_BACKTRACE_CAPACITY);
+}
+
+static void test_dump_symbolizes_on_print() {
+    clear_err_backtraces();
+
+    (void)fail_with_string();
+
+    std::ostringstream out;
+    dump_err_backtraces(out);
+
+    const std::string text = out.str();
+
+    assert(text.find("Err created at ") != std::string::npos);
+    assert(text.find("test_backtrace.cpp") != std::string::npos);
+    assert(text.find("#0 ") != std::string::npos);
+}
+
+int main() {
+    test_traced_err_is_plain_err();
+    test_sampling_rate_per_call_site();
+    test_sampling_counters_are_per_thread();
+    test_moved_payload();
+    test_ring_buffer_is_bounded();
+    test_dump_symbolizes_on_print();
+
+    return 0;
+}
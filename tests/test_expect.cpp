@@ -0,0 +1,118 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../include/result/core.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Allocation counter
+// ================================================================================================
+
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+
+    if (void *p = std::malloc(size == 0 ? 1 : size))
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class ParseError : std::uint8_t { empty = 1 };
+
+static Result<int, ParseError> parse_digit(char c) {
+    if (c < '0' || c > '9')
+        return Err(ParseError::empty);
+
+    return Ok(c - '0');
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+// Literals longer than the small string buffer used to allocate on every call.
+static void test_expect_literal_does_not_allocate() {
+    const std::size_t before = allocations;
+
+    const int digit = parse_digit('7').expect("a digit was checked by the caller before parsing");
+    assert(digit == 7);
+
+    const Result<void, ParseError> ok = Ok();
+    ok.expect("the void result was constructed as ok a moment ago");
+
+    Result<int, void> some = Ok(3);
+    assert(std::move(some).expect("the optional-like result was constructed as ok") == 3);
+
+    assert(allocations == before);
+    (void)before;
+    (void)digit;
+}
+
+static void test_expect_string_view_does_not_allocate() {
+    constexpr std::string_view message = "a digit was checked by the caller before parsing";
+    const std::size_t          before = allocations;
+
+    const int four = parse_digit('4').expect(message);
+    const int five = parse_digit('5').expect(message.substr(0, 7));
+    assert(four == 4 && five == 5);
+
+    assert(allocations == before);
+    (void)before;
+    (void)four;
+    (void)five;
+}
+
+static void test_expect_accepts_strings() {
+    const std::string message(64, 'm');
+
+    assert(parse_digit('1').expect(message) == 1);
+}
+
+static void test_expect_with_builds_message_lazily() {
+    int built = 0;
+
+    const auto make_message = [&built] {
+        ++built;
+        return std::string("digit ") + std::to_string(built) + " was not a digit";
+    };
+
+    const std::size_t before = allocations;
+
+    const int nine = parse_digit('9').expect_with(make_message);
+    assert(nine == 9);
+
+    const Result<void, ParseError> ok = Ok();
+    ok.expect_with([] { return "never built"; });
+
+    assert(built == 0);
+    assert(allocations == before);
+    (void)before;
+    (void)nine;
+}
+
+int main() {
+    test_expect_literal_does_not_allocate();
+    test_expect_string_view_does_not_allocate();
+    test_expect_accepts_strings();
+    test_expect_with_builds_message_lazily();
+
+    return 0;
+}
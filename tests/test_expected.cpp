@@ -0,0 +1,111 @@
+#include <cassert>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../include/result/expected.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class ParseError : std::uint8_t { empty = 1, not_a_digit = 2 };
+
+static std::expected<int, ParseError> parse_digit(char c) {
+    if (c < '0' || c > '9')
+        return std::unexpected(ParseError::not_a_digit);
+
+    return c - '0';
+}
+
+// Counts moves, so that tests can check that payloads are moved once.
+struct Tracked {
+    explicit Tracked(int v) : value(v) {}
+
+    Tracked(const Tracked &) = delete;
+
+    Tracked(Tracked &&other) noexcept : value(other.value), moves(other.moves + 1) {}
+
+    Tracked &operator=(const Tracked &) = delete;
+    Tracked &operator=(Tracked &&) = delete;
+
+    int value;
+    int moves = 0;
+};
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_to_expected() {
+    Result<int, ParseError> ok = Ok(7);
+    Result<int, ParseError> err = Err(ParseError::empty);
+
+    const auto e_ok = to_expected(std::move(ok));
+    const auto e_err = to_expected(std::move(err));
+
+    assert(e_ok.has_value() && *e_ok == 7);
+    assert(!e_err.has_value() && e_err.error() == ParseError::empty);
+
+    Result<void, std::string> done = Ok();
+    Result<void, std::string> failed = Err(std::string{"disk full"});
+
+    assert(to_expected(std::move(done)).has_value());
+    assert(to_expected(std::move(failed)).error() == "disk full");
+}
+
+static void test_from_expected() {
+    auto ok = from_expected(parse_digit('4'));
+    auto err = from_expected(parse_digit('x'));
+
+    assert(ok.is_ok() && ok.unwrap_ref() == 4);
+    assert(err.is_err() && err.unwrap_err_ref() == ParseError::not_a_digit);
+
+    const Result<void, int> done = from_expected(std::expected<void, int>());
+    const Result<void, int> failed = from_expected(std::expected<void, int>(std::unexpect, 3));
+
+    assert(done.is_ok());
+    assert(failed.is_err() && failed.unwrap_err_ref() == 3);
+}
+
+static void test_round_trip_moves_once() {
+    Result<Tracked, int> r = Ok(Tracked(1));
+    const int            before = r.unwrap_ref().moves;
+
+    const auto e = to_expected(std::move(r));
+    assert(e.has_value() && e->value == 1);
+    assert(e->moves == before + 1);
+    (void)before;
+
+    Result<std::unique_ptr<int>, std::string> owned = Ok(std::make_unique<int>(5));
+    auto back = from_expected(to_expected(std::move(owned)));
+    assert(back.is_ok() && *back.unwrap_ref() == 5);
+}
+
+static void test_and_then_adapter() {
+    const auto parse_next = [](int v) -> std::expected<int, ParseError> {
+        return parse_digit(static_cast<char>('0' + v + 1));
+    };
+
+    Result<int, ParseError> start = Ok(2);
+    auto chained = std::move(start).and_then(adapt_expected(parse_next));
+    assert(chained.is_ok() && chained.unwrap_ref() == 3);
+
+    Result<int, ParseError> overflow = Ok(9);
+    auto failed = std::move(overflow).and_then(adapt_expected(parse_next));
+    assert(failed.is_err() && failed.unwrap_err_ref() == ParseError::not_a_digit);
+}
+
+int main() {
+    test_to_expected();
+    test_from_expected();
+    test_round_trip_moves_once();
+    test_and_then_adapter();
+
+    return 0;
+}
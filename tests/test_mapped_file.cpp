@@ -0,0 +1,154 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../include/result/mapped_file.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+struct temp_path {
+    char path[32] = "/tmp/result_mapped_XXXXXX";
+
+    explicit temp_path(std::string_view contents) {
+        Fd fd(::mkstemp(path));
+        assert(fd.valid());
+
+        if (!contents.empty()) {
+            auto written = posix::write(fd.get(), contents.data(), contents.size());
+            assert(written.is_ok() && written.unwrap_ref() == contents.size());
+        }
+    }
+
+    ~temp_path() { ::unlink(path); }
+};
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_open_and_view() {
+    temp_path file("key = value\nport = 8080\n");
+
+    auto mapped = MappedFile::open(file.path);
+    assert(mapped.is_ok());
+
+    const MappedFile &map = mapped.unwrap_ref();
+    assert(map.size() == 24 && !map.empty());
+    assert(map.view() == "key = value\nport = 8080\n");
+
+    auto port = map.read_view(19, 4);
+    assert(port.is_ok() && port.unwrap_ref() == "8080");
+
+    // Views point into the mapping: no copy was made.
+    assert(port.unwrap_ref().data() == reinterpret_cast<const char *>(map.data()) + 19);
+}
+
+static void test_out_of_range() {
+    temp_path file("0123456789");
+    MappedFile map = MappedFile::open(file.path).unwrap();
+
+    assert(map.read_view(0, 10).is_ok());
+    assert(map.read_view(10, 0).is_ok());
+    assert(map.read_view(5, 6).unwrap_err_ref() == Errno{ERANGE});
+    assert(map.read_view(11, 0).unwrap_err_ref() == Errno{ERANGE});
+    assert(map.read_view(1, static_cast<std::size_t>(-1)).unwrap_err_ref() == Errno{ERANGE});
+}
+
+static void test_empty_file() {
+    temp_path file("");
+
+    auto mapped = MappedFile::open(file.path);
+    assert(mapped.is_ok());
+    assert(mapped.unwrap_ref().empty() && mapped.unwrap_ref().view().empty());
+    assert(mapped.unwrap_ref().read_view(0, 0).is_ok());
+    assert(mapped.unwrap_ref().read_view(0, 1).is_err());
+}
+
+static void test_errors_carry_errno() {
+    auto missing = MappedFile::open("/nonexistent/result_mapped");
+    assert(missing.is_err() && missing.unwrap_err_ref() == Errno{ENOENT});
+
+    auto bad_fd = MappedFile::map(-1);
+    assert(bad_fd.is_err() && bad_fd.unwrap_err_ref() == Errno{EBADF});
+}
+
+static void test_access_hints() {
+    std::string contents(1 << 16, 'x');
+    temp_path   file(contents);
+
+    for (MapAccess access : {MapAccess::normal, MapAccess::sequential, MapAccess::random}) {
+        auto mapped = MappedFile::open(file.path, MapOptions{access, true});
+        assert(mapped.is_ok());
+        assert(mapped.unwrap_ref().view() == contents);
+    }
+
+    MappedFile map = MappedFile::open(file.path, {MapAccess::sequential}).unwrap();
+    assert(map.advise(MapAccess::random).is_ok());
+}
+
+static void test_map_borrowed_fd() {
+    temp_path file("borrowed");
+    Fd        fd = posix::open(file.path, O_RDONLY).unwrap();
+
+    MappedFile map = MappedFile::map(fd.get()).unwrap();
+    assert(fd.valid());
+    assert(map.view() == "borrowed");
+}
+
+static void test_move() {
+    temp_path  file("moved");
+    MappedFile first = MappedFile::open(file.path).unwrap();
+    const auto *data = first.data();
+
+    MappedFile second = std::move(first);
+    assert(second.data() == data && second.view() == "moved");
+    (void)data;
+    assert(first.empty() && first.data() == nullptr);
+
+    first = std::move(second);
+    assert(first.view() == "moved" && second.empty());
+}
+
+#ifdef __cpp_lib_span
+static void test_read_span() {
+    temp_path  file("\x01\x02\x03\x04");
+    MappedFile map = MappedFile::open(file.path).unwrap();
+
+    auto bytes = map.read_span(1, 2);
+    assert(bytes.is_ok());
+
+    std::span<const std::byte> span = bytes.unwrap_ref();
+    assert(span.size() == 2 && span.data() == map.data() + 1);
+    assert(span[0] == std::byte{2} && span[1] == std::byte{3});
+
+    assert(map.read_span(2, 3).unwrap_err_ref() == Errno{ERANGE});
+}
+#endif
+
+int main() {
+    test_open_and_view();
+    test_out_of_range();
+    test_empty_file();
+    test_errors_carry_errno();
+    test_access_hints();
+    test_map_borrowed_fd();
+    test_move();
+#ifdef __cpp_lib_span
+    test_read_span();
+#endif
+
+    return 0;
+}
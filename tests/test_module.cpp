@@ -0,0 +1,71 @@
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <memory>
+#include <utility>
+
+import lsr.result;
+
+// If you compile the module with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class HalfError : std::uint8_t { empty = 1, odd = 2 };
+
+static Result<int, HalfError> half(int x) {
+    if (x % 2 != 0)
+        return Err(HalfError::odd);
+
+    return Ok(x / 2);
+}
+
+// ================================================================================================
+// Compile-time tests
+// ================================================================================================
+
+static_assert(sizeof(Result<int *, HalfError>) == sizeof(int *));
+static_assert(has_niche_v<std::unique_ptr<int>>);
+static_assert(std::is_default_constructible_v<std::hash<Result<int, HalfError>>>);
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_ok_and_err() {
+    auto even = half(8);
+    auto odd = half(3);
+
+    assert(even.is_ok() && even.unwrap_ref() == 4);
+    assert(odd.is_err() && odd.unwrap_err_ref() == HalfError::odd);
+
+    const Result<void, HalfError> done = Ok();
+    assert(done.is_ok());
+}
+
+static void test_chaining() {
+    auto quarter = half(8).and_then(half).map([](int x) { return x * 10; });
+    assert(std::move(quarter).unwrap() == 20);
+
+    auto failed = half(6).and_then(half);
+    assert(std::move(failed).unwrap_err() == HalfError::odd);
+}
+
+static void test_ptr_result() {
+    PtrResult<int, HalfError> ok = Ok(std::make_unique<int>(7));
+    PtrResult<int, HalfError> err = Err(HalfError::empty);
+
+    assert(ok.is_ok() && ok.unwrap_ref() == 7);
+    assert(std::move(err).unwrap_err() == HalfError::empty);
+}
+
+int main() {
+    test_ok_and_err();
+    test_chaining();
+    test_ptr_result();
+
+    return 0;
+}
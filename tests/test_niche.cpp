@@ -0,0 +1,340 @@
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../include/result/result.hpp"
+#include "../include/result/std_niches.hpp"
+
+#if __has_include(<unistd.h>)
+#    include "../include/result/fd.hpp"
+#endif
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Niche test types
+// ================================================================================================
+
+struct Handle {
+    int fd;
+
+    bool operator==(const Handle &other) const { return fd == other.fd; }
+};
+
+template <>
+struct niche_traits<Handle> : member_niche<&Handle::fd, -1> {};
+
+struct Slice {
+    const char *data;
+    std::size_t size;
+};
+
+template <>
+struct niche_traits<Slice> : member_niche<&Slice::size, ~std::size_t{0}> {};
+
+template <typename Tag>
+struct StrongId {
+    explicit constexpr StrongId(std::uint64_t v) : value(v) {}
+
+    bool operator==(const StrongId &other) const { return value == other.value; }
+
+    std::uint64_t value;
+};
+
+struct UserTag {};
+
+template <typename Tag>
+struct niche_traits<StrongId<Tag>> : value_niche<StrongId<Tag>, 0> {};
+
+// Hand-written niche: a tagged word whose low bit is never set.
+struct AlignedWord {
+    std::uintptr_t bits;
+};
+
+template <>
+struct niche_traits<AlignedWord> {
+    static void set_niche(AlignedWord *storage) noexcept { storage->bits = 1; }
+
+    static bool is_niche(const AlignedWord *storage) noexcept { return storage->bits == 1; }
+};
+
+struct NotFound {};
+
+struct NoNiche {
+    int value;
+};
+
+// ================================================================================================
+// Compile-time tests
+// ================================================================================================
+
+static_assert(has_niche_v<Handle>);
+static_assert(has_niche_v<Slice>);
+static_assert(has_niche_v<StrongId<UserTag>>);
+static_assert(has_niche_v<AlignedWord>);
+static_assert(!has_niche_v<NoNiche>);
+static_assert(!has_niche_v<int>);
+
+static_assert(sizeof(Result<Handle, void>) == sizeof(Handle));
+static_assert(sizeof(Result<void, Handle>) == sizeof(Handle));
+static_assert(sizeof(Result<Handle, NotFound>) == sizeof(Handle));
+static_assert(sizeof(Result<Slice, void>) == sizeof(Slice));
+static_assert(sizeof(Result<StrongId<UserTag>, void>) == sizeof(StrongId<UserTag>));
+static_assert(sizeof(Result<StrongId<UserTag>, NotFound>) == sizeof(StrongId<UserTag>));
+static_assert(sizeof(Result<AlignedWord, NotFound>) == sizeof(AlignedWord));
+
+// standard library handle types
+struct Conn {
+    int id;
+};
+
+static_assert(sizeof(Result<Conn *, void>) == sizeof(Conn *));
+static_assert(sizeof(Result<std::unique_ptr<Conn>, void>) == sizeof(Conn *));
+static_assert(sizeof(Result<std::unique_ptr<Conn>, NotFound>) == sizeof(Conn *));
+static_assert(sizeof(Result<void, std::unique_ptr<Conn>>) == sizeof(Conn *));
+static_assert(sizeof(Result<std::reference_wrapper<Conn>, void>) == sizeof(Conn *));
+static_assert(sizeof(Result<std::string_view, void>) == sizeof(std::string_view));
+static_assert(sizeof(Result<std::string_view, NotFound>) == sizeof(std::string_view));
+static_assert(!has_niche_v<std::chrono::nanoseconds>);
+static_assert(sizeof(Result<std::chrono::duration<double>, NotFound>) == sizeof(double));
+#ifdef __cpp_lib_span
+static_assert(sizeof(Result<std::span<int>, void>) == sizeof(std::span<int>));
+static_assert(!has_niche_v<std::span<int, 4>>);
+#endif
+#if __has_include(<unistd.h>)
+static_assert(sizeof(Result<Fd, void>) == sizeof(int));
+static_assert(sizeof(Result<Fd, NotFound>) == sizeof(int));
+#endif
+
+// small error enums share the word of a pointer
+enum class ConnError : std::uint8_t { refused = 1, timeout = 2 };
+enum class WideError : std::int32_t { low = -1, high = 0x7fff'ffff };
+enum class HugeError : std::uint64_t { any = 1 };
+
+#if defined(__x86_64__) || defined(__aarch64__)
+static_assert(sizeof(Result<Conn *, ConnError>) == sizeof(Conn *));
+static_assert(sizeof(Result<const Conn *, WideError>) == sizeof(Conn *));
+static_assert(sizeof(Result<Conn &, ConnError>) == sizeof(Conn *));
+#endif
+static_assert(sizeof(Result<Conn *, HugeError>) > sizeof(Conn *));
+
+// a unique_ptr with a stateful deleter is not a single pointer
+static_assert(!has_niche_v<std::unique_ptr<Conn, std::function<void(Conn *)>>>);
+
+// without a niche, or with a stateful error, the discriminant stays
+static_assert(sizeof(Result<NoNiche, void>) > sizeof(NoNiche));
+static_assert(sizeof(Result<Handle, int>) > sizeof(Handle));
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_ok_void_with_niche() {
+    Result<Handle, void> ok = Ok(Handle{3});
+    Result<Handle, void> err = Err();
+
+    assert(ok.is_ok());
+    assert(ok.unwrap_ref().fd == 3);
+    assert(err.is_err());
+
+    auto copy = ok;
+    assert(copy.is_ok() && copy.unwrap_ref().fd == 3);
+
+    const int doubled = std::move(ok).map([](Handle h) { return h.fd * 2; }).unwrap_or_default();
+    assert(doubled == 6);
+    (void)doubled;
+}
+
+static void test_void_err_with_niche() {
+    Result<void, Slice> ok = Ok();
+    Result<void, Slice> err = Err(Slice{"abc", 3});
+
+    assert(ok.is_ok());
+    assert(err.is_err());
+    assert(err.unwrap_err_ref().size == 3);
+    assert(std::string(err.unwrap_err_ref().data) == "abc");
+}
+
+static void test_general_result_with_niche() {
+    Result<StrongId<UserTag>, NotFound> found = Ok(StrongId<UserTag>{42});
+    Result<StrongId<UserTag>, NotFound> missing = Err(NotFound{});
+
+    assert(found.is_ok());
+    assert(found.unwrap_ref().value == 42);
+    assert(missing.is_err());
+
+    missing = found;
+    assert(missing.is_ok() && missing.unwrap_ref().value == 42);
+
+    found = Result<StrongId<UserTag>, NotFound>(Err(NotFound{}));
+    assert(found.is_err());
+
+    auto next = std::move(missing).and_then([](StrongId<UserTag> id) {
+        return Result<std::uint64_t, NotFound>(Ok(id.value + 1));
+    });
+    assert(std::move(next).unwrap() == 43);
+
+    auto recovered = std::move(found).or_else([](NotFound) {
+        return Result<StrongId<UserTag>, int>(Ok(StrongId<UserTag>{7}));
+    });
+    assert(recovered.unwrap_ref().value == 7);
+}
+
+static void test_custom_traits() {
+    Result<AlignedWord, NotFound> ok = Ok(AlignedWord{8});
+    Result<AlignedWord, NotFound> err = Err(NotFound{});
+
+    assert(ok.is_ok() && ok.unwrap_ref().bits == 8);
+    assert(err.is_err());
+}
+
+static void test_unique_ptr_niche() {
+    Result<std::unique_ptr<Conn>, NotFound> ok = Ok(std::make_unique<Conn>(Conn{5}));
+    Result<std::unique_ptr<Conn>, NotFound> err = Err(NotFound{});
+    Result<std::unique_ptr<Conn>, void>     null = Ok(std::unique_ptr<Conn>());
+
+    assert(ok.is_ok() && ok.unwrap_ref()->id == 5);
+    assert(err.is_err());
+    assert(null.is_ok() && null.unwrap_ref() == nullptr);
+
+    err = std::move(ok);
+    assert(err.is_ok() && err.unwrap_ref()->id == 5);
+
+    auto conn = std::move(err).unwrap();
+    assert(conn->id == 5);
+}
+
+static void test_view_niches() {
+    Result<std::string_view, void> ok = Ok(std::string_view("abc"));
+    Result<std::string_view, void> empty = Ok(std::string_view());
+    Result<std::string_view, void> err = Err();
+
+    assert(ok.is_ok() && ok.unwrap_ref() == "abc");
+    assert(empty.is_ok() && empty.unwrap_ref().empty());
+    assert(err.is_err());
+
+    Conn                                       conn{9};
+    Result<std::reference_wrapper<Conn>, void> ref = Ok(std::ref(conn));
+    assert(ref.is_ok() && ref.unwrap_ref().get().id == 9);
+
+#ifdef __cpp_lib_span
+    int                          values[] = {1, 2, 3};
+    Result<std::span<int>, void> span = Ok(std::span<int>(values));
+    Result<std::span<int>, void> no_span = Err();
+    assert(span.is_ok() && span.unwrap_ref().size() == 3);
+    assert(no_span.is_err());
+#endif
+}
+
+static void test_duration_niches() {
+    using namespace std::chrono_literals;
+
+    // Integral durations have no niche, so min() is still an Ok value.
+    Result<std::chrono::nanoseconds, void> lowest = Ok(std::chrono::nanoseconds::min());
+    Result<std::chrono::nanoseconds, void> zero = Ok(0ns);
+    Result<std::chrono::nanoseconds, void> err = Err();
+
+    assert(lowest.is_ok() && lowest.unwrap_ref() == std::chrono::nanoseconds::min());
+    assert(zero.is_ok());
+    assert(err.is_err());
+
+    using seconds_t = std::chrono::duration<double>;
+
+    Result<seconds_t, NotFound> seconds = Ok(seconds_t(1.5));
+    Result<seconds_t, NotFound> missing = Err(NotFound{});
+    assert(seconds.is_ok() && seconds.unwrap_ref().count() == 1.5);
+    assert(missing.is_err());
+}
+
+static void test_pointer_enum_encoding() {
+    Conn conn{1};
+
+    Result<Conn *, ConnError> ok = Ok(&conn);
+    Result<Conn *, ConnError> null = Ok(static_cast<Conn *>(nullptr));
+    Result<Conn *, ConnError> err = Err(ConnError::timeout);
+
+    assert(ok.is_ok() && ok.unwrap_ref() == &conn);
+    assert(null.is_ok() && null.unwrap_ref() == nullptr);
+    assert(err.is_err() && err.unwrap_err_ref() == ConnError::timeout);
+
+    err.unwrap_err_ref() = ConnError::refused;
+    assert(err.is_err() && err.unwrap_err_ref() == ConnError::refused);
+
+    ok = err;
+    assert(ok.is_err() && std::move(ok).unwrap_err() == ConnError::refused);
+
+    // The upper half is part of the error word, so copying an enclosing class keeps it.
+    struct tagged {
+        std::uint8_t              tag;
+        Result<Conn *, ConnError> result;
+    };
+
+    const tagged original{1, Err(ConnError::timeout)};
+    const tagged copy = original;
+    assert(copy.result.is_err() && copy.result.unwrap_err_ref() == ConnError::timeout);
+    (void)copy;
+
+    Result<Conn &, WideError> ref = Ok(conn);
+    Result<Conn &, WideError> low = Err(WideError::low);
+    Result<Conn &, WideError> high = Err(WideError::high);
+    assert(ref.is_ok() && &ref.unwrap_ref() == &conn);
+    assert(low.is_err() && low.unwrap_err_ref() == WideError::low);
+    assert(high.is_err() && high.unwrap_err_ref() == WideError::high);
+
+    auto id = std::move(ref).map([](Conn &c) { return c.id; });
+    assert(std::move(id).unwrap() == 1);
+}
+
+#if __has_include(<unistd.h>)
+static Result<Fd, NotFound> open_pipe_end(bool fail) {
+    if (fail)
+        return Err(NotFound{});
+
+    int fds[2];
+    if (::pipe(fds) != 0)
+        return Err(NotFound{});
+
+    ::close(fds[1]);
+    return Ok(Fd(fds[0]));
+}
+
+static void test_fd_niche() {
+    auto ok = open_pipe_end(false);
+    auto err = open_pipe_end(true);
+
+    assert(ok.is_ok() && ok.unwrap_ref().valid());
+    assert(err.is_err());
+
+    Fd fd = std::move(ok).unwrap();
+    assert(fd.valid());
+
+    Fd moved = std::move(fd);
+    assert(!fd.valid() && moved.valid());
+
+    Fd adopted(moved.release());
+    assert(!moved.valid() && adopted.valid());
+}
+#endif
+
+int main() {
+    test_ok_void_with_niche();
+    test_void_err_with_niche();
+    test_general_result_with_niche();
+    test_custom_traits();
+    test_unique_ptr_niche();
+    test_view_niches();
+    test_duration_niches();
+    test_pointer_enum_encoding();
+#if __has_include(<unistd.h>)
+    test_fd_niche();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../include/result/parse.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Compile-time checks
+// ================================================================================================
+
+static_assert(sizeof(ParseError) == 1);
+static_assert(sizeof(Result<void, ParseError>) == 1);
+static_assert(sizeof(Result<std::int32_t, ParseError>) == 8);
+static_assert(sizeof(Result<std::uint64_t, ParseError>) == 16);
+static_assert(std::is_trivially_copyable_v<Result<std::uint64_t, ParseError>>);
+static_assert(failure_bitmap_words(0) == 0 && failure_bitmap_words(64) == 1);
+static_assert(failure_bitmap_words(65) == 2);
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+// The std::from_chars verdict for `text`, i.e. what parse<T> must agree with.
+template <typename T>
+static Result<T, ParseError> reference_parse(std::string_view text) {
+    if (text.empty())
+        return Err(ParseError::empty);
+
+    return detail::parse_from_chars<T>(text);
+}
+
+template <typename T>
+static void check_matches_reference(std::string_view text) {
+    const auto actual = parse<T>(text);
+    const auto expected = reference_parse<T>(text);
+
+    assert(actual.is_ok() == expected.is_ok());
+
+    if (actual.is_ok())
+        assert(actual.unwrap_ref() == expected.unwrap_ref());
+    else
+        assert(actual.unwrap_err_ref() == expected.unwrap_err_ref());
+}
+
+template <typename T>
+static void check_matches_reference_for_all(std::string_view text) {
+    check_matches_reference<T>(text);
+}
+
+template <typename T, typename U, typename... Rest>
+static void check_matches_reference_for_all(std::string_view text) {
+    check_matches_reference<T>(text);
+    check_matches_reference_for_all<U, Rest...>(text);
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_eight_digit_chunks() {
+    assert(detail::is_eight_digits(detail::load_eight_chars("12345678")));
+    assert(detail::eight_digits_value(detail::load_eight_chars("12345678")) == 12345678);
+    assert(detail::eight_digits_value(detail::load_eight_chars("00000000")) == 0);
+    assert(detail::eight_digits_value(detail::load_eight_chars("99999999")) == 99999999);
+
+    for (const char *bad : {"1234567a", "/2345678", ":2345678", "1234 678", "-1234567"}) {
+        assert(!detail::is_eight_digits(detail::load_eight_chars(bad)));
+        (void)bad;
+    }
+}
+
+static void test_integers() {
+    assert(parse<int>("42").unwrap_ref() == 42);
+    assert(parse<int>("-42").unwrap_ref() == -42);
+    assert(parse<int>("0").unwrap_ref() == 0);
+    assert(parse<std::uint64_t>("1234567812345678").unwrap_ref() == 1234567812345678u);
+    assert(parse<std::uint64_t>("18446744073709551615").unwrap_ref() ==
+           std::numeric_limits<std::uint64_t>::max());
+    assert(parse<std::int64_t>("-9223372036854775808").unwrap_ref() ==
+           std::numeric_limits<std::int64_t>::min());
+    assert(parse<std::int64_t>("9223372036854775807").unwrap_ref() ==
+           std::numeric_limits<std::int64_t>::max());
+    assert(parse<std::uint32_t>("00000000000000000000000042").unwrap_ref() == 42);
+}
+
+static void test_errors() {
+    assert(parse<int>("").unwrap_err_ref() == ParseError::empty);
+    assert(parse<int>("-").unwrap_err_ref() == ParseError::invalid);
+    assert(parse<int>("+1").unwrap_err_ref() == ParseError::invalid);
+    assert(parse<int>(" 1").unwrap_err_ref() == ParseError::invalid);
+    assert(parse<unsigned>("-1").unwrap_err_ref() == ParseError::invalid);
+    assert(parse<int>("12a").unwrap_err_ref() == ParseError::trailing_characters);
+    assert(parse<int>("1234567a").unwrap_err_ref() == ParseError::trailing_characters);
+    assert(parse<std::int8_t>("128").unwrap_err_ref() == ParseError::out_of_range);
+    assert(parse<std::int8_t>("-129").unwrap_err_ref() == ParseError::out_of_range);
+    assert(parse<std::int8_t>("-128").unwrap_ref() == -128);
+    assert(parse<std::uint64_t>("18446744073709551616").unwrap_err_ref() ==
+           ParseError::out_of_range);
+    assert(parse<std::int64_t>("9223372036854775808").unwrap_err_ref() ==
+           ParseError::out_of_range);
+}
+
+static void test_matches_from_chars() {
+    for (std::string_view text :
+         {"0", "7", "-0", "00", "99", "255", "256", "-128", "-129", "65535", "65536", "12345678",
+          "123456789", "1234567812345678", "4294967295", "4294967296", "-2147483648",
+          "-2147483649", "9999999999999999999", "99999999999999999999", "-", "--1", "1-", "x",
+          "12345678x", "1234567x8", "123456789012345678x", "0000000000000000000001"}) {
+        check_matches_reference_for_all<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                                        std::int32_t, std::uint32_t, std::int64_t,
+                                        std::uint64_t>(text);
+    }
+
+    std::mt19937_64 rng(42);
+    const char      alphabet[] = "0123456789-a";
+    std::string     text;
+
+    for (int i = 0; i < 20000; ++i) {
+        text.assign(1 + rng() % 24, '0');
+
+        for (char &c : text)
+            c = rng() % 8 == 0 ? alphabet[rng() % 12] : static_cast<char>('0' + rng() % 10);
+
+        check_matches_reference_for_all<std::int32_t, std::uint32_t, std::int64_t,
+                                        std::uint64_t>(text);
+    }
+}
+
+#ifdef __cpp_lib_to_chars
+static void test_floating_point() {
+    assert(parse<double>("1.5").unwrap_ref() == 1.5);
+    assert(parse<double>("-2.5e3").unwrap_ref() == -2500.0);
+    assert(parse<float>("0.25").unwrap_ref() == 0.25f);
+    assert(std::isinf(parse<double>("inf").unwrap_ref()));
+    assert(parse<double>("1e999").unwrap_err_ref() == ParseError::out_of_range);
+    assert(parse<double>("1.5x").unwrap_err_ref() == ParseError::trailing_characters);
+    assert(parse<double>("x").unwrap_err_ref() == ParseError::invalid);
+    assert(parse<double>("").unwrap_err_ref() == ParseError::empty);
+}
+#endif
+
+static void test_parse_column() {
+    std::vector<std::int64_t>  out(8);
+    std::vector<std::uint64_t> failures(failure_bitmap_words(out.size()), ~std::uint64_t{0});
+
+    auto count = parse_column<std::int64_t>("1,-2,x,,40,", ',', out.data(), failures.data(),
+                                            out.size());
+    assert(count.unwrap_ref() == 5);
+    assert(out[0] == 1 && out[1] == -2 && out[2] == 0 && out[3] == 0 && out[4] == 40);
+    assert(failures[0] == 0b01100);
+
+    assert(parse_column<int>("", '\n', nullptr, nullptr, 0).unwrap_ref() == 0);
+}
+
+static void test_parse_column_spans_bitmap_words() {
+    std::string column;
+
+    for (int i = 0; i < 130; ++i) {
+        column += i % 3 == 0 ? "bad" : std::to_string(i);
+        column += '\n';
+    }
+
+    std::vector<std::uint32_t> out(130);
+    std::vector<std::uint64_t> failures(failure_bitmap_words(out.size()));
+
+    auto count = parse_column<std::uint32_t>(column, '\n', out.data(), failures.data(), 130);
+    assert(count.unwrap_ref() == 130);
+
+    for (std::size_t i = 0; i < 130; ++i) {
+        const bool failed = (failures[i / 64] >> (i % 64)) & 1;
+        assert(failed == (i % 3 == 0));
+        assert(out[i] == (failed ? 0 : i));
+        (void)failed;
+    }
+}
+
+static void test_parse_column_capacity() {
+    std::int32_t  out[2];
+    std::uint64_t failures[1];
+
+    auto count = parse_column<std::int32_t>("1 2 z", ' ', out, failures, 2);
+    assert(count.unwrap_err_ref() == ParseError::out_of_range);
+    assert(out[0] == 1 && out[1] == 2 && failures[0] == 0);
+}
+
+int main() {
+    test_eight_digit_chunks();
+    test_integers();
+    test_errors();
+    test_matches_from_chars();
+#ifdef __cpp_lib_to_chars
+    test_floating_point();
+#endif
+    test_parse_column();
+    test_parse_column_spans_bitmap_words();
+    test_parse_column_capacity();
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "../include/result/posix.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Compile-time checks
+// ================================================================================================
+
+static_assert(sizeof(Errno) == sizeof(int));
+static_assert(sizeof(Result<void, Errno>) == sizeof(int));
+static_assert(sizeof(Result<std::size_t, Errno>) == 2 * sizeof(std::size_t));
+static_assert(std::is_trivially_copyable_v<Result<std::size_t, Errno>>);
+
+#if defined(__x86_64__) || defined(__aarch64__)
+static_assert(sizeof(Result<void *, Errno>) == sizeof(void *));
+#endif
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+static Fd temp_file() {
+    char path[] = "/tmp/result_posix_XXXXXX";
+    Fd   fd(::mkstemp(path));
+
+    assert(fd.valid());
+    ::unlink(path);
+    return fd;
+}
+
+struct pipe_ends {
+    Fd read_end;
+    Fd write_end;
+};
+
+static pipe_ends make_pipe() {
+    int       fds[2] = {-1, -1};
+    const int ret = ::pipe(fds);
+
+    assert(ret == 0);
+    (void)ret;
+    return {Fd(fds[0]), Fd(fds[1])};
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_read_write() {
+    pipe_ends pipe = make_pipe();
+
+    auto written = posix::write(pipe.write_end.get(), "hello", 5);
+    assert(written.is_ok() && written.unwrap_ref() == 5);
+
+    char buf[8] = {};
+    auto got = posix::read(pipe.read_end.get(), buf, sizeof(buf));
+    assert(got.is_ok() && got.unwrap_ref() == 5);
+    assert(std::memcmp(buf, "hello", 5) == 0);
+}
+
+static void test_positional_io() {
+    Fd fd = temp_file();
+
+    auto written = posix::pwrite(fd.get(), "abcdef", 6, 0);
+    assert(written.is_ok() && written.unwrap_ref() == 6);
+
+    const Result<void, Errno> truncated = posix::ftruncate(fd.get(), 4);
+    assert(truncated.is_ok());
+
+    const Result<void, Errno> synced = posix::fsync(fd.get());
+    assert(synced.is_ok());
+
+    char buf[8] = {};
+    auto got = posix::pread(fd.get(), buf, sizeof(buf), 1);
+    assert(got.is_ok() && got.unwrap_ref() == 3);
+    assert(std::memcmp(buf, "bcd", 3) == 0);
+
+    auto size = posix::fstat(fd.get());
+    assert(size.is_ok() && size.unwrap_ref().st_size == 4);
+
+    auto end = posix::lseek(fd.get(), 0, SEEK_END);
+    assert(end.is_ok() && end.unwrap_ref() == 4);
+}
+
+static void test_errors_carry_errno() {
+    char buf[1];
+
+    auto bad_read = posix::read(-1, buf, 1);
+    assert(bad_read.is_err() && bad_read.unwrap_err_ref() == Errno{EBADF});
+
+    auto missing = posix::open("/nonexistent/result_posix", O_RDONLY);
+    assert(missing.is_err() && missing.unwrap_err_ref() == Errno{ENOENT});
+
+    const Result<void, Errno> bad_sync = posix::fsync(-1);
+    assert(bad_sync.is_err() && bad_sync.unwrap_err_ref() == Errno{EBADF});
+}
+
+static void test_open_returns_owning_fd() {
+    auto opened = posix::open("/dev/null", O_WRONLY | O_CLOEXEC);
+    assert(opened.is_ok());
+
+    Fd fd = std::move(opened).unwrap();
+    assert(fd.valid());
+
+    auto written = posix::write(fd.get(), "x", 1);
+    assert(written.is_ok() && written.unwrap_ref() == 1);
+}
+
+static void test_mmap() {
+    const std::size_t length = 4096;
+
+    auto mapped = posix::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                              -1, 0);
+    assert(mapped.is_ok());
+
+    void *addr = mapped.unwrap_ref();
+    static_cast<char *>(addr)[0] = 'x';
+
+    const Result<void, Errno> unmapped = posix::munmap(addr, length);
+    assert(unmapped.is_ok());
+
+    auto failed = posix::mmap(nullptr, 0, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert(failed.is_err() && failed.unwrap_err_ref() == Errno{EINVAL});
+}
+
+#if __has_include(<sys/epoll.h>)
+static void test_epoll() {
+    pipe_ends pipe = make_pipe();
+
+    auto epoll = posix::epoll_create1(EPOLL_CLOEXEC);
+    assert(epoll.is_ok());
+
+    const int   epfd = epoll.unwrap_ref().get();
+    epoll_event interest{};
+    interest.events = EPOLLIN;
+    interest.data.fd = pipe.read_end.get();
+
+    const Result<void, Errno> added =
+        posix::epoll_ctl(epfd, EPOLL_CTL_ADD, pipe.read_end.get(), &interest);
+    assert(added.is_ok());
+
+    epoll_event ready[4];
+    auto        idle = posix::epoll_wait(epfd, ready, 4, 0);
+    assert(idle.is_ok() && idle.unwrap_ref() == 0);
+
+    auto written = posix::write(pipe.write_end.get(), "!", 1);
+    assert(written.is_ok());
+
+    auto woken = posix::epoll_wait(epfd, ready, 4, 1000);
+    assert(woken.is_ok() && woken.unwrap_ref() == 1);
+    assert(ready[0].data.fd == pipe.read_end.get());
+}
+#endif
+
+static void test_eintr_is_retried() {
+    int calls = 0;
+
+    const int ret = posix::detail::retry_on_eintr([&] {
+        if (++calls < 3) {
+            errno = EINTR;
+            return -1;
+        }
+
+        return 7;
+    });
+
+    assert(ret == 7 && calls == 3);
+    (void)ret;
+
+    calls = 0;
+    const int failed = posix::detail::retry_on_eintr([&] {
+        ++calls;
+        errno = EAGAIN;
+        return -1;
+    });
+
+    assert(failed == -1 && calls == 1);
+    (void)failed;
+}
+
+int main() {
+    test_read_write();
+    test_positional_io();
+    test_errors_carry_errno();
+    test_open_returns_owning_fd();
+    test_mmap();
+#if __has_include(<sys/epoll.h>)
+    test_epoll();
+#endif
+    test_eintr_is_retried();
+
+    return 0;
+}
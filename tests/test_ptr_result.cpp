@@ -0,0 +1,140 @@
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/result/ptr_result.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Test types
+// ================================================================================================
+
+static int live_nodes = 0;
+
+struct alignas(16) Node {
+    explicit Node(int v) : value(v) { ++live_nodes; }
+    ~Node() { --live_nodes; }
+
+    int value;
+};
+
+enum class ErrCode : std::uint16_t { out_of_memory = 1, invalid = 2 };
+enum class SignedErr : std::int64_t { min = -(std::int64_t{1} << 62), max = std::int64_t{1} << 61 };
+
+static PtrResult<Node, ErrCode> make_node(int v) {
+    if (v < 0)
+        return Err(ErrCode::invalid);
+
+    return Ok(std::make_unique<Node>(v));
+}
+
+// ================================================================================================
+// Compile-time tests
+// ================================================================================================
+
+static_assert(sizeof(PtrResult<Node, ErrCode>) == sizeof(Node *));
+static_assert(sizeof(PtrResult<Node, SignedErr>) == sizeof(Node *));
+static_assert(sizeof(PtrResult<std::uint64_t, int>) == sizeof(std::uint64_t *));
+static_assert(!std::is_copy_constructible_v<PtrResult<Node, ErrCode>>);
+static_assert(std::is_nothrow_move_constructible_v<PtrResult<Node, ErrCode>>);
+
+// unwrap_err() consumes the result, like Result::unwrap_err().
+template <typename R, typename = void>
+inline constexpr bool lvalue_unwrap_err_v = false;
+
+template <typename R>
+inline constexpr bool
+    lvalue_unwrap_err_v<R, std::void_t<decltype(std::declval<R &>().unwrap_err())>> = true;
+
+static_assert(!lvalue_unwrap_err_v<PtrResult<Node, ErrCode>>);
+static_assert(!lvalue_unwrap_err_v<Result<int, ErrCode>>);
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_ok_and_err() {
+    {
+        auto ok = make_node(4);
+        auto err = make_node(-1);
+
+        assert(ok.is_ok() && !ok.is_err());
+        assert(ok.get() != nullptr && ok.unwrap_ref().value == 4);
+        assert(err.is_err() && err.get() == nullptr);
+        assert(std::move(err).unwrap_err() == ErrCode::invalid);
+        assert(live_nodes == 1);
+    }
+
+    assert(live_nodes == 0);
+}
+
+static void test_ownership_transfer() {
+    auto ok = make_node(7);
+
+    auto moved = std::move(ok);
+    assert(ok.is_ok() && ok.get() == nullptr);
+    assert(moved.unwrap_ref().value == 7);
+
+    moved = make_node(-1);
+    assert(moved.is_err() && live_nodes == 0);
+
+    moved = make_node(8);
+    auto node = std::move(moved).unwrap();
+    assert(node->value == 8 && moved.get() == nullptr);
+    assert(live_nodes == 1);
+
+    node.reset();
+    assert(live_nodes == 0);
+
+    auto fallback = make_node(-1).unwrap_or(std::make_unique<Node>(9));
+    assert(fallback->value == 9);
+}
+
+static void test_signed_error_codes() {
+    PtrResult<Node, SignedErr> low = Err(SignedErr::min);
+    PtrResult<Node, SignedErr> high = Err(SignedErr::max);
+    PtrResult<Node, int>       negative = Err(-3);
+
+    assert(std::move(low).unwrap_err() == SignedErr::min);
+    assert(std::move(high).unwrap_err() == SignedErr::max);
+    assert(std::move(negative).unwrap_err_unchecked() == -3);
+}
+
+static void test_into_result() {
+    auto ok = make_node(3).into_result();
+    auto err = make_node(-1).into_result();
+
+    assert(std::move(ok).map([](std::unique_ptr<Node> n) { return n->value; }).unwrap() == 3);
+    assert(std::move(err).unwrap_err() == ErrCode::invalid);
+    assert(live_nodes == 0);
+}
+
+static void test_node_array() {
+    std::vector<PtrResult<Node, ErrCode>> nodes;
+    for (int i = -4; i < 4; ++i)
+        nodes.push_back(make_node(i));
+
+    int oks = 0;
+    for (const auto &n : nodes)
+        oks += n.is_ok() ? 1 : 0;
+
+    assert(oks == 4 && live_nodes == 4);
+
+    nodes.clear();
+    assert(live_nodes == 0);
+}
+
+int main() {
+    test_ok_and_err();
+    test_ownership_transfer();
+    test_signed_error_codes();
+    test_into_result();
+    test_node_array();
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../include/result/record_reader.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Allocation counter
+// ================================================================================================
+
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+
+    if (void *p = std::malloc(size == 0 ? 1 : size))
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+static Fd file_with(std::string_view contents) {
+    char path[] = "/tmp/result_records_XXXXXX";
+    Fd   fd(::mkstemp(path));
+
+    assert(fd.valid());
+    ::unlink(path);
+
+    if (!contents.empty()) {
+        auto written = posix::write(fd.get(), contents.data(), contents.size());
+        assert(written.is_ok() && written.unwrap_ref() == contents.size());
+    }
+
+    auto rewound = posix::lseek(fd.get(), 0, SEEK_SET);
+    assert(rewound.is_ok());
+    return fd;
+}
+
+// Every record until end_of_stream; record_too_long shows up as "<too long>".
+[[maybe_unused]] static std::vector<std::string> drain(RecordReader &reader) {
+    std::vector<std::string> records;
+
+    for (;;) {
+        auto record = reader.next();
+
+        if (record.is_ok()) {
+            records.emplace_back(record.unwrap_ref());
+            continue;
+        }
+
+        if (record.unwrap_err_ref() == ReadError::end_of_stream)
+            return records;
+
+        assert(record.unwrap_err_ref() == ReadError::record_too_long);
+        records.emplace_back("<too long>");
+    }
+}
+
+using records = std::vector<std::string>;
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_lines_from_fd() {
+    Fd           fd = file_with("alpha\nbeta\n\ngamma");
+    RecordReader reader(fd.get());
+
+    assert((drain(reader) == records{"alpha", "beta", "", "gamma"}));
+    assert(reader.next().unwrap_err_ref() == ReadError::end_of_stream);
+}
+
+static void test_records_across_refills() {
+    std::string contents;
+    records     expected;
+
+    for (int i = 0; i < 500; ++i) {
+        expected.push_back(std::string(static_cast<std::size_t>(i % 13), 'a' + i % 26));
+        contents += expected.back();
+        contents += ';';
+    }
+
+    // Every buffer size cuts some records at a refill boundary.
+    for (std::size_t buffer_size : {13u, 16u, 17u, 64u, 4096u}) {
+        Fd           fd = file_with(contents);
+        RecordReader reader(fd.get(), ';', buffer_size);
+
+        assert(drain(reader) == expected);
+    }
+}
+
+static void test_record_too_long_is_skipped() {
+    Fd           fd = file_with("ok\n0123456789abcdef0123456789\nnext\n0123456789abcdef");
+    RecordReader reader(fd.get(), '\n', 8);
+
+    assert((drain(reader) == records{"ok", "<too long>", "next", "<too long>"}));
+}
+
+static void test_read_errors_carry_errno() {
+    RecordReader reader(-1);
+
+    auto record = reader.next();
+    assert(record.is_err() && is_errno(record.unwrap_err_ref()));
+    assert(record.unwrap_err_ref() == read_error(Errno{EBADF}));
+    assert(!is_errno(ReadError::end_of_stream) && !is_errno(ReadError::record_too_long));
+}
+
+static void test_pipe() {
+    int       fds[2] = {-1, -1};
+    const int piped = ::pipe(fds);
+    assert(piped == 0);
+    (void)piped;
+
+    Fd read_end(fds[0]);
+    Fd write_end(fds[1]);
+
+    auto written = posix::write(write_end.get(), "one\ntw", 6);
+    assert(written.is_ok());
+
+    RecordReader reader(read_end.get(), '\n', 64);
+    auto         record = reader.next();
+    assert(record.unwrap_ref() == "one");
+
+    written = posix::write(write_end.get(), "o\n", 2);
+    assert(written.is_ok());
+
+    record = reader.next();
+    assert(record.unwrap_ref() == "two");
+
+    write_end.reset();
+    record = reader.next();
+    assert(record.unwrap_err_ref() == ReadError::end_of_stream);
+}
+
+static void test_region() {
+    const std::string_view region = "k=v\nx=y\n";
+    RecordReader           reader(region);
+
+    auto first = reader.next();
+    assert(first.unwrap_ref() == "k=v" && first.unwrap_ref().data() == region.data());
+    assert(reader.next().unwrap_ref() == "x=y");
+    assert(reader.next().unwrap_err_ref() == ReadError::end_of_stream);
+
+    RecordReader empty{std::string_view()};
+    assert(empty.next().unwrap_err_ref() == ReadError::end_of_stream);
+}
+
+static void test_next_does_not_allocate() {
+    std::string contents;
+    for (int i = 0; i < 10000; ++i)
+        contents += "a line that is longer than the small string buffer\n";
+
+    Fd           fd = file_with(contents);
+    RecordReader reader(fd.get(), '\n', 1024);
+
+    const std::size_t before = allocations;
+    std::size_t       count = 0;
+
+    while (reader.next().is_ok())
+        ++count;
+
+    assert(count == 10000);
+    assert(allocations == before);
+    (void)before;
+}
+
+int main() {
+    test_lines_from_fd();
+    test_records_across_refills();
+    test_record_too_long_is_skipped();
+    test_read_errors_carry_errno();
+    test_pipe();
+    test_region();
+    test_next_does_not_allocate();
+
+    return 0;
+}
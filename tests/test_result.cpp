@@ -1,10 +1,12 @@
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -75,6 +77,17 @@ enum class BigEnum : std::uint32_t { ok = 0u, warning = 1u, error = 2u, max_name
 
 enum class SignedBigEnum : std::int32_t { negative = -100, zero = 0, positive = 100 };
 
+enum class DenseSmallEnum : std::uint8_t { d0, d1, d2, d3, d4, d5, d6, d7, d8 };
+
+enum class SignedSmallEnum : std::int8_t { lowest = -128, low = -127 };
+
+enum UnscopedSmallEnum : std::uint8_t { unscoped_a, unscoped_b };
+
+template <class A, class B>
+struct EnumHolder {
+    enum class Nested : std::uint8_t { first, second };
+};
+
 // ================================================================================================
 // Compile-time tests
 // ================================================================================================
@@ -265,6 +278,21 @@ static_assert(tiny::impl::automatic_enum_sentinel<SignedBigEnum> != SignedBigEnu
 static_assert(tiny::impl::automatic_enum_sentinel<SignedBigEnum> != SignedBigEnum::zero);
 static_assert(tiny::impl::automatic_enum_sentinel<SignedBigEnum> != SignedBigEnum::positive);
 
+// the first free value lies past the first probe batch
+static_assert(tiny::impl::automatic_enum_sentinel<DenseSmallEnum> ==
+              static_cast<DenseSmallEnum>(9));
+
+static_assert(tiny::impl::automatic_enum_sentinel<SignedSmallEnum> ==
+              static_cast<SignedSmallEnum>(-126));
+
+// unscoped enumerators are rendered without a qualifier
+static_assert(tiny::impl::automatic_enum_sentinel<UnscopedSmallEnum> ==
+              static_cast<UnscopedSmallEnum>(2));
+
+// commas inside the enum's type name must not split the probed values
+static_assert(tiny::impl::automatic_enum_sentinel<EnumHolder<int, char>::Nested> ==
+              static_cast<EnumHolder<int, char>::Nested>(2));
+
 // ================================================================================================
 // Runtime tests
 // ================================================================================================
@@ -686,6 +714,163 @@ static void test_move_only_err_type() {
     assert(std::move(mapped_err).unwrap_err() == 21);
 }
 
+static void test_copy_and_assign_across_sides() {
+    using R = Result<std::string, std::string>;
+
+    static_assert(std::is_copy_constructible_v<R> && std::is_copy_assignable_v<R>);
+    static_assert(std::is_nothrow_move_constructible_v<R>);
+    static_assert(!std::is_copy_constructible_v<Result<std::unique_ptr<int>, int>>);
+    static_assert(std::is_move_assignable_v<Result<std::unique_ptr<int>, int>>);
+    static_assert(std::is_trivially_copyable_v<Result<int, long>>);
+
+    R ok(Ok(std::string(64, 'o')));
+    R err(Err(std::string(64, 'e')));
+
+    R r = ok;
+    r = err;
+    assert(r.is_err());
+    assert(r.unwrap_err_ref() == err.unwrap_err_ref());
+
+    r = ok;
+    assert(r.is_ok());
+    assert(r.unwrap_ref() == ok.unwrap_ref());
+
+    r = std::move(err);
+    assert(r.is_err());
+    assert(r.unwrap_err_ref() == std::string(64, 'e'));
+
+    Result<std::unique_ptr<int>, std::string> p(Ok(std::make_unique<int>(7)));
+    p = Result<std::unique_ptr<int>, std::string>(Err(std::string{"gone"}));
+    assert(p.is_err());
+}
+
+static void test_trivially_copyable_sides() {
+    using R = Result<int, SignedBigEnum>;
+
+    static_assert(std::is_trivially_copyable_v<R>);
+    static_assert(sizeof(R) == 2 * sizeof(int));
+    static_assert(!std::is_trivially_copyable_v<Result<int, std::string>>);
+
+    R ok(Ok(42));
+    R err(Err(SignedBigEnum::negative));
+
+    R r = ok;
+    r = err;
+    assert(r.is_err());
+    assert(r.unwrap_err_ref() == SignedBigEnum::negative);
+
+    r = ok;
+    assert(r.is_ok());
+    assert(r.unwrap_ref() == 42);
+
+    R copy = ok;
+    std::memcpy(static_cast<void *>(&copy), &err, sizeof(R));
+    assert(copy.is_err());
+    assert(copy.unwrap_err_ref() == SignedBigEnum::negative);
+
+    auto next = std::move(r).and_then([](int x) -> R { return Ok(x + 1); });
+    assert(std::move(next).unwrap() == 43);
+}
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+// Copyable, with a move constructor that throws on demand.
+struct throwing_move {
+    static inline bool fail = false;
+
+    int value;
+
+    explicit throwing_move(int v) : value(v) {}
+    throwing_move(const throwing_move &) = default;
+    throwing_move(throwing_move &&other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("move");
+    }
+    throwing_move &operator=(const throwing_move &) = default;
+    throwing_move &operator=(throwing_move &&) = default;
+};
+
+static void test_switching_sides_with_throwing_move() {
+    using R = Result<throwing_move, std::string>;
+
+    static_assert(std::is_nothrow_move_assignable_v<Result<std::string, std::string>>);
+    static_assert(!std::is_nothrow_move_assignable_v<R>);
+    static_assert(!std::is_nothrow_copy_assignable_v<R>);
+
+    const R ok(Ok(throwing_move(1)));
+    R       r(Err(std::string(64, 'e')));
+
+    // The new side is copied, then moved in; when the move throws, the error is put back.
+    throwing_move::fail = true;
+    bool thrown = false;
+
+    try {
+        r = ok;
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    throwing_move::fail = false;
+    assert(thrown && r.is_err());
+    assert(r.unwrap_err_ref() == std::string(64, 'e'));
+    (void)thrown;
+
+    r = ok;
+    assert(r.is_ok() && r.unwrap_ref().value == 1);
+}
+#endif
+
+static void test_hash() {
+    using R = Result<int, std::string>;
+
+    std::unordered_set<R> seen;
+    seen.insert(Ok(1));
+    seen.insert(Ok(1));
+    seen.insert(Err(std::string{"x"}));
+    assert(seen.size() == 2);
+    assert(seen.count(Ok(1)) == 1);
+    assert(seen.count(Err(std::string{"x"})) == 1);
+
+    // A niche-packed Result hashes like its payload.
+    using Packed = Result<int, void, -1>;
+    using PackedHash = std::hash<Packed>;
+
+    assert(PackedHash{}(Ok(5)) == std::hash<int>{}(5));
+    assert(PackedHash{}(Err()) == PackedHash{}(Err()));
+
+    using Ref = Result<int &, void>;
+    using Flag = Result<void, void>;
+    int value = 3;
+
+    assert(std::hash<Ref>{}(Ok<int &>(value)) == std::hash<int>{}(3));
+    assert(std::hash<Flag>{}(Ok()) != std::hash<Flag>{}(Err()));
+
+    static_assert(std::is_default_constructible_v<std::hash<Result<void, int>>>);
+    static_assert(!std::is_default_constructible_v<std::hash<Result<int, std::vector<int>>>>);
+}
+
+#ifdef __cpp_lib_three_way_comparison
+static void test_three_way_comparison() {
+    using R = Result<int, std::string>;
+
+    // Ok orders before Err; equal states compare their values.
+    assert(R(Ok(2)) < R(Err(std::string{"a"})));
+    assert(R(Ok(1)) < R(Ok(2)));
+    assert(R(Err(std::string{"a"})) < R(Err(std::string{"b"})));
+    assert((R(Ok(1)) <=> R(Ok(1))) == 0);
+
+    using Optional = Result<int, void>;
+    using Status = Result<void, int>;
+    using Flag = Result<void, void>;
+
+    assert(Optional(Ok(9)) < Optional(Err()));
+    assert(Status(Err(1)) < Status(Err(2)));
+    assert(Flag(Ok()) < Flag(Err()));
+
+    using Real = Result<double, int>;
+    static_assert(std::is_same_v<decltype(Real(Ok(1.0)) <=> Real(Ok(2.0))), std::partial_ordering>);
+}
+#endif
+
 static void test_equality_positive_cases_only() {
     Result<int, std::string> ok1(Ok(1));
     Result<int, std::string> ok2(Ok(1));
@@ -1024,8 +1209,19 @@ int main() {
     test_move_only_ok_type();
     test_move_only_err_type();
 
+    test_copy_and_assign_across_sides();
+    test_trivially_copyable_sides();
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    test_switching_sides_with_throwing_move();
+#endif
+
     test_equality_positive_cases_only();
 
+    test_hash();
+#ifdef __cpp_lib_three_way_comparison
+    test_three_way_comparison();
+#endif
+
     test_sentinel_niche_result_t_void();
     test_sentinel_niche_result_void_e();
 
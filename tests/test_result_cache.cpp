@@ -0,0 +1,323 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/result/result_cache.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+// A clock that only moves when a test advances it.
+struct manual_clock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+
+    static constexpr bool is_steady = true;
+
+    static inline std::atomic<rep> ticks{0};
+
+    static time_point now() noexcept { return time_point(duration(ticks.load())); }
+
+    static void advance(duration by) noexcept { ticks += by.count(); }
+};
+
+enum class LookupError { not_found, timeout };
+
+using Cache = ResultCache<int, std::string, LookupError, std::hash<int>, manual_clock>;
+using Policy = Cache::policy_type;
+
+static Policy ttl_policy() {
+    Policy policy;
+    policy.ok_ttl = std::chrono::milliseconds(1000);
+    policy.err_ttl = std::chrono::milliseconds(100);
+    policy.cache_err = [](LookupError e) { return e != LookupError::timeout; };
+    return policy;
+}
+
+// Looks up every key, setting their reference bits, and returns how many are cached.
+static int cached(Cache &cache, std::initializer_list<int> keys) {
+    int count = 0;
+
+    for (const int key : keys)
+        count += cache.find(key).has_value();
+
+    return count;
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_hit_and_miss() {
+    Cache cache(64, ttl_policy());
+    int   calls = 0;
+
+    const auto lookup = [&calls](int key) -> Result<std::string, LookupError> {
+        ++calls;
+        return Ok(std::to_string(key));
+    };
+
+    auto miss = cache.get_or_compute(7, lookup);
+    auto hit = cache.get_or_compute(7, lookup);
+    auto other = cache.get_or_compute(8, lookup);
+    assert(miss.unwrap_ref() == "7" && hit.unwrap_ref() == "7" && other.unwrap_ref() == "8");
+    assert(calls == 2 && cache.size() == 2);
+
+    const ResultCacheStats stats = cache.stats();
+    assert(stats.hits == 1 && stats.misses == 2 && stats.coalesced == 0);
+    (void)stats;
+
+    auto found = cache.find(7);
+    auto missing = cache.find(9);
+    assert(found.value().unwrap_ref() == "7" && !missing.has_value());
+
+    const bool erased = cache.erase(7);
+    const bool erased_again = cache.erase(7);
+    assert(erased && !erased_again);
+    (void)erased;
+    (void)erased_again;
+
+    auto gone = cache.find(7);
+    assert(!gone.has_value() && cache.size() == 1);
+
+    cache.clear();
+    assert(cache.size() == 0);
+}
+
+static void test_ttl_per_outcome() {
+    Cache cache(64, ttl_policy());
+    cache.insert(1, Ok(std::string("one")));
+    cache.insert(2, Err(LookupError::not_found));
+
+    manual_clock::advance(std::chrono::milliseconds(99));
+    auto ok = cache.find(1);
+    auto err = cache.find(2);
+    assert(ok.has_value() && err.value().unwrap_err_ref() == LookupError::not_found);
+
+    // Errors expire first.
+    manual_clock::advance(std::chrono::milliseconds(1));
+    ok = cache.find(1);
+    err = cache.find(2);
+    assert(ok.has_value() && !err.has_value());
+
+    manual_clock::advance(std::chrono::milliseconds(900));
+    ok = cache.find(1);
+    assert(!ok.has_value() && cache.size() == 0);
+}
+
+static void test_transient_errors_are_not_cached() {
+    Cache cache(64, ttl_policy());
+    int   calls = 0;
+
+    const auto flaky = [&calls](int) -> Result<std::string, LookupError> {
+        ++calls;
+        return Err(LookupError::timeout);
+    };
+
+    auto first = cache.get_or_compute(3, flaky);
+    auto second = cache.get_or_compute(3, flaky);
+    assert(first.unwrap_err_ref() == LookupError::timeout);
+    assert(second.unwrap_err_ref() == LookupError::timeout);
+    assert(calls == 2 && cache.size() == 0);
+
+    // The default policy caches no error at all and keeps successes forever.
+    Cache defaults(64, Policy{});
+    defaults.insert(1, Err(LookupError::not_found));
+    defaults.insert(2, Ok(std::string("two")));
+
+    manual_clock::advance(std::chrono::hours(24 * 365));
+    auto err = defaults.find(1);
+    auto ok = defaults.find(2);
+    assert(!err.has_value() && ok.has_value());
+}
+
+static void test_single_flight() {
+    constexpr int threads = 8;
+
+    Cache             cache(64, ttl_policy());
+    std::atomic<int>  calls{0};
+    std::atomic<bool> release{false};
+
+    const auto slow = [&](int key) -> Result<std::string, LookupError> {
+        ++calls;
+        while (!release.load())
+            std::this_thread::yield();
+
+        return Ok(std::to_string(key));
+    };
+
+    std::vector<std::thread> callers;
+    std::atomic<int>         correct{0};
+
+    for (int t = 0; t < threads; ++t) {
+        callers.emplace_back([&] {
+            if (cache.get_or_compute(42, slow).unwrap_ref() == "42")
+                ++correct;
+        });
+    }
+
+    // Every caller but the one computing is parked on the flight before it lands.
+    while (cache.stats().coalesced != threads - 1)
+        std::this_thread::yield();
+
+    release = true;
+    for (auto &caller : callers)
+        caller.join();
+
+    assert(calls == 1 && correct == threads);
+
+    const ResultCacheStats stats = cache.stats();
+    assert(stats.misses == 1 && stats.coalesced == threads - 1);
+    (void)stats;
+}
+
+static void test_waiters_share_uncached_outcomes() {
+    constexpr int threads = 4;
+
+    Cache             cache(64, ttl_policy());
+    std::atomic<int>  calls{0};
+    std::atomic<bool> release{false};
+
+    const auto timing_out = [&](int) -> Result<std::string, LookupError> {
+        ++calls;
+        while (!release.load())
+            std::this_thread::yield();
+
+        return Err(LookupError::timeout);
+    };
+
+    std::vector<std::thread> callers;
+    for (int t = 0; t < threads; ++t) {
+        callers.emplace_back([&] {
+            auto outcome = cache.get_or_compute(5, timing_out);
+            assert(outcome.unwrap_err_ref() == LookupError::timeout);
+        });
+    }
+
+    while (cache.stats().coalesced != threads - 1)
+        std::this_thread::yield();
+
+    release = true;
+    for (auto &caller : callers)
+        caller.join();
+
+    assert(calls == 1 && cache.size() == 0);
+}
+
+static void test_clock_eviction() {
+    Cache cache(4, ttl_policy(), 1);
+    assert(cache.capacity() == 4);
+
+    for (int key = 0; key < 4; ++key)
+        cache.insert(key, Ok(std::to_string(key)));
+
+    // Keys 0, 1 and 3 are referenced; the hand passes over them and replaces key 2.
+    int found = cached(cache, {0, 1, 3});
+    assert(found == 3);
+    cache.insert(4, Ok(std::string("4")));
+
+    assert(cache.size() == 4 && cache.stats().evictions == 1);
+    found = cached(cache, {2});
+    assert(found == 0);
+    found = cached(cache, {0, 1, 3, 4});
+    assert(found == 4);
+
+    // A slot freed by erase() is reused without evicting anything.
+    const bool erased = cache.erase(1);
+    assert(erased);
+    (void)erased;
+    cache.insert(5, Ok(std::string("5")));
+    assert(cache.size() == 4 && cache.stats().evictions == 1);
+
+    // The hand clears the bits of keys 3 and 0 and stops at key 5, which was never hit.
+    cache.insert(6, Ok(std::string("6")));
+    found = cached(cache, {5});
+    assert(cache.stats().evictions == 2 && found == 0);
+    found = cached(cache, {0, 3, 4, 6});
+    assert(found == 4);
+
+    // Expired entries are replaced even when they are referenced.
+    manual_clock::advance(std::chrono::milliseconds(1000));
+    cache.insert(7, Ok(std::string("7")));
+    found = cached(cache, {7});
+    assert(cache.stats().evictions == 3 && found == 1);
+    (void)found;
+}
+
+static void test_expired_entries_are_replaced_first() {
+    Cache cache(2, ttl_policy(), 1);
+    cache.insert(0, Ok(std::string("0")));
+    cache.insert(1, Err(LookupError::not_found));
+
+    // Key 0 is unreferenced and under the hand, but the expired error goes first.
+    manual_clock::advance(std::chrono::milliseconds(100));
+    cache.insert(2, Ok(std::string("2")));
+
+    const int found = cached(cache, {0, 2});
+    assert(found == 2 && cache.stats().evictions == 1);
+    (void)found;
+}
+
+static void test_cache_err_may_use_the_cache() {
+    Cache *self = nullptr;
+
+    // The policy runs without the shard lock, so a size() that locks every shard cannot deadlock.
+    Policy policy = ttl_policy();
+    policy.cache_err = [&self](LookupError) { return self->size() == 0; };
+
+    Cache reentrant(64, policy);
+    self = &reentrant;
+
+    reentrant.insert(1, Err(LookupError::not_found));
+    auto err = reentrant.get_or_compute(
+        2, [](int) -> Result<std::string, LookupError> { return Err(LookupError::not_found); });
+
+    assert(err.unwrap_err_ref() == LookupError::not_found);
+    assert(reentrant.size() == 1);
+}
+
+static void test_throwing_computation() {
+    Cache cache(64, ttl_policy());
+
+    bool thrown = false;
+    try {
+        (void)cache.get_or_compute(
+            1, [](int) -> Result<std::string, LookupError> { throw std::runtime_error("down"); });
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+
+    // The flight is gone: the next caller computes again.
+    assert(thrown && cache.size() == 0);
+    (void)thrown;
+
+    auto recomputed = cache.get_or_compute(
+        1, [](int) -> Result<std::string, LookupError> { return Ok(std::string("up")); });
+    assert(recomputed.unwrap_ref() == "up");
+}
+
+int main() {
+    test_hit_and_miss();
+    test_ttl_per_outcome();
+    test_transient_errors_are_not_cached();
+    test_single_flight();
+    test_waiters_share_uncached_outcomes();
+    test_clock_eviction();
+    test_expired_entries_are_replaced_first();
+    test_cache_err_may_use_the_cache();
+    test_throwing_computation();
+
+    return 0;
+}
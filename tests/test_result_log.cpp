@@ -0,0 +1,296 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/result/result_log.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+using CountLog = ResultLog<std::uint32_t, Errno>;
+
+// A path for a segment that does not exist yet; ResultLog::open creates it.
+struct temp_path {
+    char path[32] = "/tmp/result_log_XXXXXX";
+
+    temp_path() {
+        Fd fd(::mkstemp(path));
+        assert(fd.valid());
+        ::unlink(path);
+    }
+
+    ~temp_path() { ::unlink(path); }
+};
+
+template <typename Log>
+static std::vector<typename Log::result_type> read_all(const Log &log) {
+    std::vector<typename Log::result_type> results;
+
+    log.for_each([&](const typename Log::Entry &entry) {
+        auto result = entry.read();
+        assert(result.is_ok());
+        results.push_back(std::move(result).unwrap());
+    });
+
+    return results;
+}
+
+template <typename Log>
+static void append_ok(Log &log, typename Log::result_type result) {
+    auto appended = log.append(result);
+    assert(appended.is_ok());
+}
+
+static void write_at(const char *path, std::size_t offset, const void *data, std::size_t size) {
+    Fd fd(::open(path, O_RDWR));
+    assert(fd.valid());
+
+    const ssize_t written = ::pwrite(fd.get(), data, size, static_cast<off_t>(offset));
+    assert(written == static_cast<ssize_t>(size));
+    (void)written;
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_append_and_read() {
+    temp_path file;
+    auto      opened = ResultLog<std::string, int>::open(file.path, 4096);
+    assert(opened.is_ok());
+
+    ResultLog<std::string, int> &log = opened.unwrap_ref();
+    assert(log.capacity() == 4096 && log.used() == 64);
+
+    append_ok(log, Ok(std::string("done")));
+    append_ok(log, Err(7));
+    append_ok(log, Ok(std::string()));
+
+    const auto results = read_all(log);
+    assert(results.size() == 3);
+    assert(results[0].unwrap_ref() == "done");
+    assert(results[1].unwrap_err_ref() == 7);
+    assert(results[2].unwrap_ref().empty());
+
+    // Records are 8-byte aligned: header, tag and the string with its length prefix.
+    assert(log.used() == 64 + (8 + 16) + (8 + 8) + (8 + 16));
+
+    const Result<void, Errno> synced = log.sync();
+    assert(synced.is_ok());
+}
+
+static void test_concurrent_append() {
+    temp_path file;
+    CountLog  log = CountLog::open(file.path, 1 << 20).unwrap();
+
+    constexpr std::uint32_t threads = 4;
+    constexpr std::uint32_t per_thread = 2000;
+
+    std::vector<std::thread> writers;
+    for (std::uint32_t t = 0; t < threads; ++t) {
+        writers.emplace_back([&log, t] {
+            for (std::uint32_t i = 0; i < per_thread; ++i) {
+                std::uint32_t item = t * per_thread + i;
+
+                if (item % 10 == 0)
+                    append_ok(log, Err(Errno{EIO}));
+                else
+                    append_ok(log, Ok(std::move(item)));
+            }
+        });
+    }
+
+    for (auto &writer : writers)
+        writer.join();
+
+    std::size_t       failed = 0;
+    std::vector<bool> seen(threads * per_thread);
+    const auto        results = read_all(log);
+
+    for (const auto &result : results) {
+        if (result.is_err()) {
+            assert(result.unwrap_err_ref() == Errno{EIO});
+            ++failed;
+            continue;
+        }
+
+        assert(!seen[result.unwrap_ref()]);
+        seen[result.unwrap_ref()] = true;
+    }
+
+    assert(results.size() == threads * per_thread);
+    assert(failed == threads * per_thread / 10);
+}
+
+static void test_reopen() {
+    temp_path file;
+
+    {
+        CountLog log = CountLog::open(file.path, 4096).unwrap();
+        append_ok(log, Ok(1u));
+        append_ok(log, Ok(2u));
+    }
+
+    // An existing segment keeps its size and its records; appends continue behind them.
+    CountLog log = CountLog::open(file.path, 64 * 1024).unwrap();
+    assert(log.capacity() == 4096 && log.torn_records() == 0);
+    append_ok(log, Ok(3u));
+
+    const auto results = read_all(log);
+    assert(results.size() == 3);
+    assert(results[0].unwrap_ref() == 1 && results[2].unwrap_ref() == 3);
+}
+
+static void test_torn_record_is_skipped() {
+    temp_path                file;
+    std::vector<std::size_t> offsets;
+
+    {
+        CountLog log = CountLog::open(file.path, 4096).unwrap();
+        for (std::uint32_t i = 0; i < 3; ++i)
+            append_ok(log, Ok(std::move(i)));
+
+        log.for_each([&](const CountLog::Entry &entry) { offsets.push_back(entry.offset); });
+    }
+
+    // A crash in the middle of the second record: its payload does not match the commit.
+    const char garbage = 0x5a;
+    write_at(file.path, offsets[1] + 8 + 1, &garbage, 1);
+
+    CountLog log = CountLog::open(file.path, 4096).unwrap();
+    assert(log.torn_records() == 1);
+    append_ok(log, Ok(9u));
+
+    const auto results = read_all(log);
+    assert(results.size() == 3);
+    assert(results[0].unwrap_ref() == 0);
+    assert(results[1].unwrap_ref() == 2);
+    assert(results[2].unwrap_ref() == 9);
+}
+
+static void test_crashed_reservation_keeps_later_records() {
+    temp_path                file;
+    std::vector<std::size_t> offsets;
+
+    {
+        CountLog log = CountLog::open(file.path, 4096).unwrap();
+        for (std::uint32_t i = 0; i < 3; ++i)
+            append_ok(log, Ok(std::move(i)));
+
+        log.for_each([&](const CountLog::Entry &entry) { offsets.push_back(entry.offset); });
+    }
+
+    // The writer of the second record crashed right after its reservation, while the writer of
+    // the third one committed: only the size of the second record made it to the segment.
+    const std::uint8_t zeros[16] = {};
+    write_at(file.path, offsets[1] + 4, zeros, sizeof(zeros) - 4);
+
+    CountLog log = CountLog::open(file.path, 4096).unwrap();
+    assert(log.torn_records() == 1);
+    append_ok(log, Ok(9u));
+
+    const auto results = read_all(log);
+    assert(results.size() == 3);
+    assert(results[0].unwrap_ref() == 0);
+    assert(results[1].unwrap_ref() == 2);
+    assert(results[2].unwrap_ref() == 9);
+}
+
+static void test_tail_is_scrubbed() {
+    temp_path   file;
+    std::size_t end;
+
+    {
+        CountLog log = CountLog::open(file.path, 4096).unwrap();
+        append_ok(log, Ok(1u));
+        end = log.used();
+    }
+
+    // Garbage behind the last record, with a size word that no reservation accounts for.
+    const std::uint64_t noise = 0xdeadbeefcafef00d;
+    const std::uint32_t size = 5;
+    write_at(file.path, end + 8, &noise, sizeof(noise));
+    write_at(file.path, end + 16, &size, sizeof(size));
+
+    CountLog log = CountLog::open(file.path, 4096).unwrap();
+    assert(log.used() == end && log.torn_records() == 0);
+
+    append_ok(log, Ok(2u));
+    append_ok(log, Ok(3u));
+
+    const auto results = read_all(log);
+    assert(results.size() == 3 && results[2].unwrap_ref() == 3);
+}
+
+static void test_full_segment() {
+    temp_path file;
+
+    // 64 bytes of header and room for four 16-byte records.
+    CountLog log = CountLog::open(file.path, 128).unwrap();
+
+    for (std::uint32_t i = 0; i < 4; ++i)
+        append_ok(log, Ok(std::move(i)));
+
+    const Result<void, Errno> full = log.append(Ok(4u));
+    const Result<void, Errno> still_full = log.append(Ok(5u));
+    assert(full.unwrap_err_ref() == Errno{ENOSPC});
+    assert(still_full.unwrap_err_ref() == Errno{ENOSPC});
+    assert(log.used() == log.capacity());
+
+    const auto results = read_all(log);
+    assert(results.size() == 4);
+}
+
+static void test_invalid_segments() {
+    temp_path file;
+    auto      too_small = CountLog::open(file.path, 32);
+    assert(too_small.unwrap_err_ref() == Errno{EINVAL});
+
+    const std::string text(256, 'x');
+    write_at(file.path, 0, text.data(), text.size());
+
+    auto bad_magic = CountLog::open(file.path, 4096);
+    assert(bad_magic.unwrap_err_ref() == Errno{EINVAL});
+
+    auto missing = CountLog::open("/nonexistent/result.log", 4096);
+    assert(missing.unwrap_err_ref() == Errno{ENOENT});
+}
+
+static void test_move() {
+    temp_path file;
+    CountLog  first = CountLog::open(file.path, 4096).unwrap();
+    append_ok(first, Ok(1u));
+
+    CountLog second = std::move(first);
+    append_ok(second, Ok(2u));
+
+    const auto results = read_all(second);
+    assert(results.size() == 2);
+}
+
+int main() {
+    test_append_and_read();
+    test_concurrent_append();
+    test_reopen();
+    test_torn_record_is_skipped();
+    test_crashed_reservation_keeps_later_records();
+    test_tail_is_scrubbed();
+    test_full_segment();
+    test_invalid_segments();
+    test_move();
+
+    return 0;
+}
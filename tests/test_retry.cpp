@@ -0,0 +1,302 @@
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/result/retry.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+using namespace std::chrono_literals;
+
+// A clock that only moves when a test advances it.
+struct manual_clock {
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+
+    static constexpr bool is_steady = true;
+
+    static inline std::atomic<rep> ticks{0};
+
+    static time_point now() noexcept { return time_point(duration(ticks.load())); }
+
+    static void advance(duration by) noexcept { ticks += by.count(); }
+};
+
+using Policy = RetryPolicy<manual_clock>;
+using Budget = RetryBudget<manual_clock>;
+
+// Records every delay and advances the clock by it instead of sleeping.
+struct recording_sleep {
+    std::vector<std::chrono::nanoseconds> *delays;
+
+    void operator()(std::chrono::nanoseconds delay) const {
+        delays->push_back(delay);
+        manual_clock::advance(delay);
+    }
+};
+
+// Fails with `error` for the first `failures` calls, then returns the number of calls.
+struct flaky {
+    int   failures;
+    Errno error;
+    int   calls = 0;
+
+    Result<int, Errno> operator()() {
+        if (++calls <= failures)
+            return Err(Errno{error});
+
+        return Ok(int{calls});
+    }
+};
+
+enum class DbError { deadlock, constraint };
+
+template <>
+struct retry_traits<DbError> {
+    static bool is_retryable(DbError e) noexcept { return e == DbError::deadlock; }
+};
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_succeeds_after_transient_errors() {
+    std::vector<std::chrono::nanoseconds> delays;
+    flaky                                 op{2, Errno{EAGAIN}};
+
+    auto result = retry(Policy{}, op, recording_sleep{&delays});
+    assert(result.is_ok() && result.unwrap_ref() == 3);
+    assert(op.calls == 3 && delays.size() == 2);
+}
+
+static void test_permanent_errors_are_returned() {
+    std::vector<std::chrono::nanoseconds> delays;
+    flaky                                 op{5, Errno{ENOENT}};
+
+    auto result = retry(Policy{}, op, recording_sleep{&delays});
+    assert(result.unwrap_err_ref() == Errno{ENOENT});
+    assert(op.calls == 1 && delays.empty());
+
+    // A specialized trait decides for its own error type.
+    int  calls = 0;
+    auto db = retry(
+        Policy{},
+        [&calls]() -> Result<void, DbError> {
+            return Err(++calls < 3 ? DbError::deadlock : DbError::constraint);
+        },
+        recording_sleep{&delays});
+
+    assert(db.unwrap_err_ref() == DbError::constraint && calls == 3);
+}
+
+static void test_max_attempts() {
+    std::vector<std::chrono::nanoseconds> delays;
+    flaky                                 op{100, Errno{ETIMEDOUT}};
+
+    Policy policy;
+    policy.max_attempts = 5;
+
+    auto result = retry(policy, op, recording_sleep{&delays});
+    assert(result.unwrap_err_ref() == Errno{ETIMEDOUT});
+    assert(op.calls == 5 && delays.size() == 4);
+}
+
+static void test_decorrelated_jitter() {
+    Policy policy;
+    policy.max_attempts = 64;
+    policy.base_delay = 1ms;
+    policy.max_delay = 50ms;
+    policy.seed = 42;
+
+    std::vector<std::chrono::nanoseconds> first;
+    flaky                                 op{100, Errno{EAGAIN}};
+    (void)retry(policy, op, recording_sleep{&first});
+    assert(first.size() == 63);
+
+    // Each delay lies in [base, 3 * previous], capped at max_delay.
+    std::chrono::nanoseconds previous = policy.base_delay;
+    bool                     capped = false;
+
+    for (const auto delay : first) {
+        assert(delay >= policy.base_delay && delay <= policy.max_delay);
+        assert(delay <= 3 * previous);
+        capped |= delay > 40ms;
+        previous = delay;
+    }
+
+    assert(capped);
+
+    // The same seed gives the same schedule.
+    std::vector<std::chrono::nanoseconds> second;
+    flaky                                 again{100, Errno{EAGAIN}};
+    (void)retry(policy, again, recording_sleep{&second});
+    assert(first == second);
+}
+
+static void test_max_elapsed() {
+    Policy policy;
+    policy.max_attempts = 1000;
+    policy.base_delay = 10ms;
+    policy.max_delay = 10ms;
+    policy.max_elapsed = 35ms;
+
+    std::vector<std::chrono::nanoseconds> delays;
+    flaky                                 op{1000, Errno{EBUSY}};
+    (void)retry(policy, op, recording_sleep{&delays});
+
+    // Sleeps end at 10, 20 and 30 ms; a fourth one would end past 35 ms.
+    assert(delays.size() == 3 && op.calls == 4);
+}
+
+static void test_budget() {
+    Budget budget(2, 1s);
+
+    Policy policy;
+    policy.max_attempts = 10;
+    policy.budget = &budget;
+
+    std::vector<std::chrono::nanoseconds> delays;
+
+    // Sleeping would refill the bucket, so these callers do not advance the clock.
+    const auto no_sleep = [&delays](std::chrono::nanoseconds delay) { delays.push_back(delay); };
+
+    flaky first{100, Errno{ECONNRESET}};
+    (void)retry(policy, first, no_sleep);
+    assert(first.calls == 3);
+
+    // The bucket is empty: the next caller gets its first attempt only.
+    flaky second{100, Errno{ECONNRESET}};
+    (void)retry(policy, second, no_sleep);
+    assert(second.calls == 1);
+
+    manual_clock::advance(1s);
+    flaky third{100, Errno{ECONNRESET}};
+    (void)retry(policy, third, no_sleep);
+    assert(third.calls == 2);
+
+    // A first attempt never takes a token.
+    flaky ok{0, Errno{}};
+    auto succeeded = retry(policy, ok, no_sleep);
+    assert(succeeded.is_ok() && ok.calls == 1);
+    assert(delays.size() == 3);
+}
+
+static void test_budget_is_shared_across_threads() {
+    constexpr int threads = 8;
+
+    Budget           budget(100, 1s);
+    std::atomic<int> granted{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i)
+                granted += budget.try_acquire();
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    assert(granted == 100);
+
+    manual_clock::advance(3s);
+    int refilled = 0;
+    for (int i = 0; i < 4; ++i)
+        refilled += budget.try_acquire();
+
+    assert(refilled == 3);
+}
+
+#ifdef __cpp_impl_coroutine
+// ================================================================================================
+// Coroutine tests
+// ================================================================================================
+
+// An awaitable that is ready at once: the outcome of an attempt, or a zero-length timer.
+template <typename T>
+struct ready {
+    T value;
+
+    bool await_ready() const noexcept { return true; }
+
+    void await_suspend(std::coroutine_handle<>) const noexcept {}
+
+    T await_resume() { return std::move(value); }
+};
+
+// Eager coroutine that awaits a RetryTask and stores its outcome.
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+template <typename R>
+static detached await_into(RetryTask<R> task, std::optional<R> &out) {
+    out.emplace(co_await task);
+}
+
+static void test_async_retry() {
+    std::vector<std::chrono::nanoseconds> delays;
+    int                                   calls = 0;
+
+    auto task = async_retry(
+        Policy{},
+        [&calls]() {
+            ++calls;
+            return ready<Result<int, Errno>>{calls < 3 ? Result<int, Errno>(Err(Errno{EINTR}))
+                                                       : Result<int, Errno>(Ok(7))};
+        },
+        [&delays](std::chrono::nanoseconds delay) {
+            delays.push_back(delay);
+            return ready<int>{0};
+        });
+
+    // Lazy: nothing runs before the task is awaited.
+    assert(calls == 0);
+
+    std::optional<Result<int, Errno>> out;
+    await_into(std::move(task), out);
+
+    assert(out && out->unwrap_ref() == 7);
+    assert(calls == 3 && delays.size() == 2);
+}
+#endif
+
+int main() {
+    test_succeeds_after_transient_errors();
+    test_permanent_errors_are_returned();
+    test_max_attempts();
+    test_decorrelated_jitter();
+    test_max_elapsed();
+    test_budget();
+    test_budget_is_shared_across_threads();
+#ifdef __cpp_impl_coroutine
+    test_async_retry();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/result/serialize.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class Code : int {};
+
+template <>
+struct niche_traits<Code> : value_niche<Code, Code{}> {};
+
+enum class Status : std::uint8_t { failed = 1, timed_out };
+
+struct NotFound {};
+
+struct Point {
+    std::int32_t x;
+    std::int32_t y;
+
+    bool operator==(const Point &other) const { return x == other.x && y == other.y; }
+};
+
+// A user payload that is not trivially copyable.
+struct Job {
+    std::string   name;
+    std::uint32_t attempts;
+};
+
+template <>
+struct serializer<Job> {
+    template <typename Writer>
+    static void write(const Job &job, Writer &out) {
+        serialize(job.name, out);
+        serialize(job.attempts, out);
+    }
+
+    template <typename Reader>
+    static Result<Job, SerializeError> read(Reader &in) {
+        auto name = serializer<std::string>::read(in);
+        if (name.is_err())
+            return Err(std::move(name).unwrap_err());
+
+        auto attempts = serializer<std::uint32_t>::read(in);
+        if (attempts.is_err())
+            return Err(std::move(attempts).unwrap_err());
+
+        return Ok(Job{std::move(name).unwrap(), std::move(attempts).unwrap()});
+    }
+};
+
+template <typename R>
+static std::vector<std::byte> bytes_of(const R &value) {
+    BufferWriter out;
+    serialize(value, out);
+    return std::move(out).take();
+}
+
+template <typename R>
+static R round_trip(const R &value, std::size_t expected_size) {
+    const auto   bytes = bytes_of(value);
+    BufferReader in(bytes);
+
+    assert(bytes.size() == expected_size);
+    (void)expected_size;
+
+    auto back = deserialize<R>(in);
+    assert(back.is_ok() && in.empty());
+    return std::move(back).unwrap();
+}
+
+// ================================================================================================
+// Compile-time checks
+// ================================================================================================
+
+static_assert(serializer<Result<void, Code>>::bitwise);
+static_assert(serializer<Result<Code, void>>::bitwise);
+static_assert(serializer<Result<Code, NotFound>>::bitwise);
+static_assert(!serializer<Result<int, long>>::bitwise);
+static_assert(!serializer<Result<int, std::string>>::bitwise);
+static_assert(!serializer<Result<void, void>>::bitwise);
+
+#if defined(__x86_64__) || defined(__aarch64__)
+static_assert(serializer<Result<Point *, Status>>::bitwise);
+#endif
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_niche_packed_results_have_no_tag() {
+    using R [[maybe_unused]] = Result<void, Code>;
+
+    assert(round_trip(R(Ok()), sizeof(Code)).is_ok());
+    assert(round_trip(R(Err(Code{5})), sizeof(Code)).unwrap_err_ref() == Code{5});
+
+    using S [[maybe_unused]] = Result<Code, NotFound>;
+
+    assert(round_trip(S(Ok(Code{7})), sizeof(Code)).unwrap_ref() == Code{7});
+    assert(round_trip(S(Err(NotFound{})), sizeof(Code)).is_err());
+}
+
+static void test_tagged_results() {
+    using R [[maybe_unused]] = Result<Point, Status>;
+
+    assert((round_trip(R(Ok(Point{1, -2})), 1 + sizeof(Point)).unwrap_ref() == Point{1, -2}));
+    assert(round_trip(R(Err(Status::timed_out)), 2).unwrap_err_ref() == Status::timed_out);
+
+    using V [[maybe_unused]] = Result<void, void>;
+
+    assert(round_trip(V(Ok()), 1).is_ok());
+    assert(round_trip(V(Err()), 1).is_err());
+
+    using S [[maybe_unused]] = Result<std::string, std::string>;
+
+    assert(round_trip(S(Ok(std::string("value"))), 1 + 8 + 5).unwrap_ref() == "value");
+    assert(round_trip(S(Err(std::string())), 1 + 8).unwrap_err_ref().empty());
+}
+
+static void test_user_payloads_and_nesting() {
+    using R = Result<Job, Result<void, Code>>;
+
+    const auto job = round_trip(R(Ok(Job{"compact", 3})), 1 + 8 + 7 + 4).unwrap();
+    assert(job.name == "compact" && job.attempts == 3);
+
+    const auto err = round_trip(R(Err(Result<void, Code>(Err(Code{9})))), 1 + 4);
+    assert(err.unwrap_err_ref().unwrap_err_ref() == Code{9});
+}
+
+static void test_stream() {
+    using R = Result<std::uint64_t, std::string>;
+
+    BufferWriter out;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        if (i % 7 == 0)
+            serialize(R(Err("failed " + std::to_string(i))), out);
+        else
+            serialize(R(Ok(i * i)), out);
+    }
+
+    BufferReader in(out.bytes());
+    std::uint64_t next = 0;
+
+    auto count = deserialize_each<R>(in, [&](R r) {
+        if (next % 7 == 0)
+            assert(r.unwrap_err_ref() == "failed " + std::to_string(next));
+        else
+            assert(r.unwrap_ref() == next * next);
+
+        (void)r;
+        ++next;
+    });
+
+    assert(count.unwrap_ref() == 100 && next == 100);
+}
+
+static void test_malformed_input() {
+    using R = Result<std::string, Status>;
+
+    BufferReader empty(nullptr, 0);
+    assert(deserialize<R>(empty).unwrap_err_ref() == SerializeError::end_of_stream);
+
+    const std::byte bad_tag[] = {std::byte{2}};
+    BufferReader    tag_in(bad_tag, sizeof(bad_tag));
+    assert(deserialize<R>(tag_in).unwrap_err_ref() == SerializeError::invalid_tag);
+
+    auto bytes = bytes_of(R(Ok(std::string("truncated"))));
+    bytes.pop_back();
+
+    BufferReader truncated_in(bytes);
+    assert(deserialize<R>(truncated_in).unwrap_err_ref() == SerializeError::truncated);
+
+    // A forged length prefix fails before the string is allocated.
+    BufferWriter forged;
+    serialize(std::uint8_t{0}, forged);
+    serialize(std::uint64_t{1} << 40, forged);
+    serialize(std::uint64_t{0}, forged);
+
+    BufferReader forged_in(forged.bytes());
+    assert(deserialize<R>(forged_in).unwrap_err_ref() == SerializeError::truncated);
+
+    // A stream that ends inside its second record.
+    BufferWriter out;
+    serialize(R(Err(Status::failed)), out);
+    serialize(R(Ok(std::string("x"))), out);
+
+    BufferReader stream(out.bytes().data(), out.bytes().size() - 1);
+    std::size_t  seen = 0;
+    auto         count = deserialize_each<R>(stream, [&](R) { ++seen; });
+    assert(count.unwrap_err_ref() == SerializeError::truncated && seen == 1);
+}
+
+int main() {
+    test_niche_packed_results_have_no_tag();
+    test_tagged_results();
+    test_user_payloads_and_nesting();
+    test_stream();
+    test_malformed_input();
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/result/result.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class LookupError : std::uint8_t { missing = 0 };
+
+static constexpr std::uint32_t err_line = __LINE__ + 6;
+
+static Result<int, LookupError> lookup(int key) {
+    if (key % 4 == 0)
+        return Ok(key * 2);
+
+    return Err(LookupError::missing);
+}
+
+static const site_count *find_site(const std::vector<site_count> &sites, std::uint32_t line) {
+    for (const auto &site : sites) {
+        if (site.line == line && std::string{site.file}.find("test_site_counters.cpp") !=
+                                     std::string::npos)
+            return &site;
+    }
+
+    return nullptr;
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_err_construction_is_counted_per_site() {
+    for (int i = 0; i < 8; ++i)
+        (void)lookup(i);
+
+    const auto  sites = site_counters_snapshot();
+    const auto *site = find_site(sites, err_line);
+
+    assert(site != nullptr);
+    assert(site->err == 6);
+    assert(site->ok == 0);
+    (void)site;
+}
+
+static void test_unwrap_is_counted_per_site() {
+    const std::uint32_t unwrap_line = __LINE__ + 5;
+
+    int sum = 0;
+    for (int i = 0; i < 3; ++i) {
+        Result<int, void> r(Ok(i + 1));
+        sum += std::move(r).unwrap();
+    }
+
+    assert(sum == 6);
+
+    const auto  sites = site_counters_snapshot();
+    const auto *site = find_site(sites, unwrap_line);
+
+    assert(site != nullptr);
+    assert(site->ok == 3);
+    assert(site->err == 0);
+    (void)site;
+}
+
+static void test_shards_are_merged_across_threads() {
+    const auto before = find_site(site_counters_snapshot(), err_line)->err;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 1; i <= 100; ++i)
+                (void)lookup(i);
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    // 75 of every 100 keys fail, and counts of exited threads are kept
+    const auto sites = site_counters_snapshot();
+    assert(find_site(sites, err_line)->err == before + 4 * 75);
+    (void)before;
+
+    std::ostringstream out;
+    dump_site_counters(out);
+
+    assert(out.str().find("test_site_counters.cpp:" + std::to_string(err_line)) !=
+           std::string::npos);
+}
+
+int main() {
+    test_err_construction_is_counted_per_site();
+    test_unwrap_is_counted_per_site();
+    test_shards_are_merged_across_threads();
+
+    return 0;
+}
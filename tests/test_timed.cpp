@@ -0,0 +1,185 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../include/result/timed.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+// Deterministic clock: every now() call advances time by `step` nanoseconds.
+struct StepClock {
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<StepClock>;
+
+    static constexpr bool is_steady = true;
+
+    static inline thread_local std::int64_t now_ns = 0;
+    static inline thread_local std::int64_t step = 0;
+
+    static time_point now() noexcept {
+        now_ns += step;
+        return time_point{duration{now_ns}};
+    }
+};
+
+// ================================================================================================
+// Compile-time tests
+// ================================================================================================
+
+static_assert(latency_histogram::bucket_of(0) == 0);
+static_assert(latency_histogram::bucket_of(7) == 7);
+static_assert(latency_histogram::bucket_of(8) == 8);
+static_assert(latency_histogram::bucket_of(15) == 15);
+static_assert(latency_histogram::bucket_of(16) == 16);
+static_assert(latency_histogram::bucket_of(17) == 16);
+static_assert(latency_histogram::bucket_of(18) == 17);
+
+static_assert(latency_histogram::lower_bound(latency_histogram::bucket_of(1000)) <= 1000);
+static_assert(latency_histogram::lower_bound(latency_histogram::bucket_of(1000) + 1) > 1000);
+static_assert(latency_histogram::lower_bound(latency_histogram::bucket_of(123456789)) <= 123456789);
+static_assert(latency_histogram::lower_bound(latency_histogram::bucket_of(123456789) + 1) >
+              123456789);
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_ok_and_err_are_recorded_separately() {
+    basic_latency_recorder<StepClock> recorder;
+
+    auto parse = timed(recorder, [](int x) -> Result<int, std::string> {
+        if (x < 0)
+            return Err(std::string{"negative"});
+
+        return Ok(x * 2);
+    });
+
+    StepClock::step = 100;
+    for (int i = 0; i < 10; ++i) {
+        auto r = parse(i);
+        assert(r.is_ok());
+        assert(r.unwrap_ref() == i * 2);
+    }
+
+    StepClock::step = 5000;
+    for (int i = 0; i < 3; ++i) {
+        auto r = parse(-1);
+        assert(r.is_err());
+        assert(r.unwrap_err_ref() == "negative");
+    }
+
+    const auto ok = recorder.ok_histogram();
+    const auto err = recorder.err_histogram();
+
+    assert(ok.count() == 10);
+    assert(err.count() == 3);
+
+    assert(ok.count_in(latency_histogram::bucket_of(100)) == 10);
+    assert(err.count_in(latency_histogram::bucket_of(5000)) == 3);
+
+    assert(ok.quantile(0.5) == latency_histogram::lower_bound(latency_histogram::bucket_of(100)));
+    assert(err.quantile(0.99) == latency_histogram::lower_bound(latency_histogram::bucket_of(5000)));
+    (void)ok;
+    (void)err;
+}
+
+static void test_return_type_is_preserved() {
+    latency_recorder recorder;
+
+    auto check = timed(recorder, [] { return Result<void, int>(Ok()); });
+
+    static_assert(std::is_same_v<decltype(check()), Result<void, int>>);
+    assert(check().is_ok());
+    assert(recorder.ok_histogram().count() == 1);
+    assert(recorder.err_histogram().count() == 0);
+}
+
+static void test_thread_shards_are_merged() {
+    latency_recorder recorder;
+
+    auto work = timed(recorder, [](int x) {
+        return x % 2 == 0 ? Result<int, void>(Ok(x + 0)) : Result<int, void>(Err());
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&work] {
+            for (int i = 0; i < 1000; ++i)
+                (void)work(i);
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    assert(recorder.ok_histogram().count() == 2000);
+    assert(recorder.err_histogram().count() == 2000);
+}
+
+static void test_exited_threads_hand_over_their_shards() {
+    latency_recorder recorder;
+
+    for (int t = 0; t < 32; ++t) {
+        std::thread thread([&recorder] {
+            for (int i = 0; i < 10; ++i)
+                recorder.record(i % 2 == 0, 100);
+        });
+        thread.join();
+    }
+
+    // One thread at a time: every thread adopts the shard of the previous one.
+    const auto shards = recorder.shard_count();
+    const auto ok = recorder.ok_histogram().count();
+    const auto err = recorder.err_histogram().count();
+    assert(shards == 1 && ok == 160 && err == 160);
+    (void)shards;
+    (void)ok;
+    (void)err;
+}
+
+static void test_thread_outlives_recorder() {
+    std::atomic<bool> recorded{false};
+    std::atomic<bool> destroyed{false};
+    std::thread       thread;
+
+    {
+        latency_recorder recorder;
+
+        thread = std::thread([&] {
+            recorder.record(true, 100);
+            recorded.store(true);
+
+            // Exits, and releases its shard, only after the recorder is gone.
+            while (!destroyed.load())
+                std::this_thread::yield();
+        });
+
+        while (!recorded.load())
+            std::this_thread::yield();
+    }
+
+    destroyed.store(true);
+    thread.join();
+}
+
+int main() {
+    test_ok_and_err_are_recorded_separately();
+    test_return_type_is_preserved();
+    test_thread_shards_are_merged();
+    test_exited_threads_hand_over_their_shards();
+    test_thread_outlives_recorder();
+
+    return 0;
+}
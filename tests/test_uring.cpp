@@ -0,0 +1,277 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include "../include/result/uring.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Compile-time checks
+// ================================================================================================
+
+static_assert(sizeof(Result<std::uint32_t, Errno>) == sizeof(std::uint64_t));
+static_assert(std::is_trivially_copyable_v<Result<std::uint32_t, Errno>>);
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+static Fd temp_file() {
+    char path[] = "/tmp/result_uring_XXXXXX";
+    Fd   fd(::mkstemp(path));
+
+    assert(fd.valid());
+    ::unlink(path);
+    return fd;
+}
+
+static std::vector<UringCompletion> submit_and_reap(Uring &ring, unsigned expected) {
+    std::vector<UringCompletion> completions;
+
+    auto submitted = ring.submit(expected);
+    assert(submitted.is_ok());
+
+    while (completions.size() < expected) {
+        ring.reap([&](const UringCompletion &c) { completions.push_back(c); });
+
+        if (completions.size() < expected) {
+            auto waited = ring.submit(1);
+            assert(waited.is_ok());
+        }
+    }
+
+    return completions;
+}
+
+[[maybe_unused]] static const UringCompletion &find(
+    const std::vector<UringCompletion> &completions, std::uint64_t user_data) {
+    for (const auto &c : completions) {
+        if (c.user_data == user_data)
+            return c;
+    }
+
+    std::fprintf(stderr, "missing completion %llu\n", static_cast<unsigned long long>(user_data));
+    std::abort();
+}
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+static void test_create() {
+    auto ring = Uring::create(8);
+    assert(ring.is_ok());
+    assert(ring.unwrap_ref().fd() >= 0);
+
+    auto sqpoll = Uring::create(8, IORING_SETUP_SQPOLL);
+    assert(sqpoll.is_err() && sqpoll.unwrap_err_ref() == Errno{EINVAL});
+
+    auto too_large = Uring::create(1u << 30);
+    assert(too_large.is_err());
+}
+
+static void test_batched_write_and_read() {
+    Uring ring = Uring::create(8).unwrap();
+    Fd    fd = temp_file();
+
+    io_uring_sqe *first = ring.prep_write(fd.get(), "hello ", 6, 0, 1);
+    io_uring_sqe *second = ring.prep_write(fd.get(), "world", 5, 6, 2);
+    assert(first && second);
+    (void)first;
+    (void)second;
+
+    auto written = submit_and_reap(ring, 2);
+    assert(find(written, 1).result.unwrap_ref() == 6);
+    assert(find(written, 2).result.unwrap_ref() == 5);
+
+    char buf[16] = {};
+    io_uring_sqe *reread = ring.prep_read(fd.get(), buf, sizeof(buf), 0, 3);
+    assert(reread);
+    (void)reread;
+
+    auto read = submit_and_reap(ring, 1);
+    assert(read[0].user_data == 3 && read[0].result.unwrap_ref() == 11);
+    assert(std::memcmp(buf, "hello world", 11) == 0);
+}
+
+static void test_errors_carry_errno() {
+    Uring ring = Uring::create(4).unwrap();
+    char  buf[4];
+
+    io_uring_sqe *bad = ring.prep_read(-1, buf, sizeof(buf), 0, 7);
+    assert(bad);
+    (void)bad;
+
+    auto completions = submit_and_reap(ring, 1);
+    const auto &result = completions[0].result;
+    assert(result.is_err() && result.unwrap_err_ref() == Errno{EBADF});
+    (void)result;
+}
+
+static void test_linked_ops() {
+    Uring ring = Uring::create(8).unwrap();
+    Fd    fd = temp_file();
+    char  buf[8] = {};
+
+    // write -> fsync -> read runs in order.
+    Uring::link(ring.prep_write(fd.get(), "linked", 6, 0, 1));
+    Uring::link(ring.prep_fsync(fd.get(), 2));
+    ring.prep_read(fd.get(), buf, sizeof(buf), 0, 3);
+
+    auto ok = submit_and_reap(ring, 3);
+    assert(find(ok, 1).result.unwrap_ref() == 6);
+    assert(find(ok, 2).result.is_ok());
+    assert(find(ok, 3).result.unwrap_ref() == 6);
+    assert(std::memcmp(buf, "linked", 6) == 0);
+
+    // A failing head cancels the rest of the chain.
+    Uring::link(ring.prep_read(-1, buf, sizeof(buf), 0, 4));
+    ring.prep_nop(5);
+
+    auto failed = submit_and_reap(ring, 2);
+    assert(find(failed, 4).result.unwrap_err_ref() == Errno{EBADF});
+    assert(find(failed, 5).result.unwrap_err_ref() == Errno{ECANCELED});
+}
+
+static void test_full_submission_queue() {
+    Uring ring = Uring::create(2).unwrap();
+
+    unsigned prepared = 0;
+    while (ring.prep_nop(prepared))
+        ++prepared;
+
+    io_uring_sqe *overflow = ring.prep_nop(99);
+    assert(prepared >= 2 && overflow == nullptr);
+    assert(Uring::link(nullptr) == nullptr);
+    (void)overflow;
+
+    auto completions = submit_and_reap(ring, prepared);
+    assert(completions.size() == prepared);
+
+    io_uring_sqe *drained = ring.prep_nop(100);
+    assert(drained != nullptr);
+    (void)drained;
+}
+
+static void test_move() {
+    Uring first = Uring::create(4).unwrap();
+    const int fd = first.fd();
+
+    Uring second = std::move(first);
+    assert(second.fd() == fd);
+    (void)fd;
+
+    io_uring_sqe *nop = second.prep_nop(1);
+    assert(nop);
+    (void)nop;
+
+    auto completions = submit_and_reap(second, 1);
+    assert(completions[0].result.unwrap_ref() == 0);
+}
+
+#ifdef __cpp_impl_coroutine
+// ================================================================================================
+// Coroutines
+// ================================================================================================
+
+struct detached {
+    struct promise_type {
+        detached get_return_object() noexcept { return {}; }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+struct copy_state {
+    bool                         done = false;
+    Result<std::uint32_t, Errno> written = Err(Errno{EINVAL});
+    Result<std::uint32_t, Errno> read = Err(Errno{EINVAL});
+    Result<std::uint32_t, Errno> bad = Ok(0u);
+    char                         buf[16] = {};
+};
+
+static detached write_then_read(Uring &ring, int fd, copy_state &state) {
+    state.written = co_await ring.async_write(fd, "coroutine", 9, 0);
+    state.read = co_await ring.async_read(fd, state.buf, sizeof(state.buf), 0);
+    state.bad = co_await ring.async_fsync(-1);
+    state.done = true;
+}
+
+static void test_coroutine_awaiter() {
+    Uring      ring = Uring::create(4).unwrap();
+    Fd         fd = temp_file();
+    copy_state state;
+
+    write_then_read(ring, fd.get(), state);
+
+    while (!state.done) {
+        auto waited = ring.submit(1);
+        assert(waited.is_ok());
+        ring.reap();
+    }
+
+    assert(state.written.unwrap_ref() == 9);
+    assert(state.read.unwrap_ref() == 9);
+    assert(std::memcmp(state.buf, "coroutine", 9) == 0);
+    assert(state.bad.unwrap_err_ref() == Errno{EBADF});
+}
+
+static detached await_completed(Uring &ring, bool &done) {
+    UringOp op = ring.async_nop();
+
+    // Reaped before the co_await: the result is stored and returned without suspending.
+    auto              submitted = ring.submit(1);
+    const std::size_t reaped = ring.reap();
+    assert(submitted.is_ok() && reaped == 1 && op.await_ready());
+    (void)reaped;
+
+    auto result = co_await op;
+    assert(result.unwrap_ref() == 0);
+    done = true;
+}
+
+static void test_coroutine_completed_before_await() {
+    Uring ring = Uring::create(4).unwrap();
+    bool  done = false;
+
+    await_completed(ring, done);
+    assert(done);
+}
+#endif
+
+int main() {
+    if (Uring::create(1).is_err()) {
+        std::fprintf(stderr, "io_uring is unavailable, skipping\n");
+        return 0;
+    }
+
+    test_create();
+    test_batched_write_and_read();
+    test_errors_carry_errno();
+    test_linked_ops();
+    test_full_submission_queue();
+    test_move();
+#ifdef __cpp_impl_coroutine
+    test_coroutine_awaiter();
+    test_coroutine_completed_before_await();
+#endif
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "../include/result/result.hpp"
+
+// If you compile your Result with RESULT_NAMESPACE defined, uncomment this.
+// using namespace lsr::result;
+
+// ================================================================================================
+// Helpers
+// ================================================================================================
+
+enum class IoError : std::uint8_t { timeout = 1 };
+
+static Result<int, IoError> read_value(bool fail) {
+    if (fail)
+        return Err(IoError::timeout);
+
+    return Ok(42);
+}
+
+// Opaque to the optimizer, so that the panic paths of unwrap() and expect() survive -O2.
+static volatile bool no_failure = false;
+
+// ================================================================================================
+// Runtime tests
+// ================================================================================================
+
+// Probes must not change behavior; the note check in CMake verifies they were emitted.
+static void test_err_probes_are_transparent() {
+    const Result<void, void> a = Err();
+    const Result<int, void>  b = Err();
+    const Result<void, int>  c = Err(7);
+    const auto               d = read_value(true);
+
+    assert(a.is_err());
+    assert(b.is_err());
+    assert(c.is_err() && c.unwrap_err_ref() == 7);
+    assert(d.is_err() && d.unwrap_err_ref() == IoError::timeout);
+}
+
+static void test_panic_probe_is_transparent() {
+    // Instantiates the panic path without taking it.
+    const int unwrapped = read_value(no_failure).unwrap();
+    const int expected = read_value(no_failure).expect(std::string{"value"});
+    assert(unwrapped == 42 && expected == 42);
+    (void)unwrapped;
+    (void)expected;
+}
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+static void test_throw_probe_is_transparent() {
+    bool thrown = false;
+
+    try {
+        Result<int, std::runtime_error> r = Err(std::runtime_error{"timeout"});
+        static_cast<void>(std::move(r).unwrap_or_throw());
+    } catch (const std::runtime_error &e) {
+        thrown = std::string{e.what()} == "timeout";
+    }
+
+    assert(thrown);
+    (void)thrown;
+}
+#endif
+
+int main() {
+    test_err_probes_are_transparent();
+    test_panic_probe_is_transparent();
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    test_throw_probe_is_transparent();
+#endif
+
+    return 0;
+}